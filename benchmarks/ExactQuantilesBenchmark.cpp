@@ -0,0 +1,88 @@
+// ExactQuantilesBenchmark times the parallel exact quantile engine against
+// std::nth_element on a copy of the values. It reports the throughput of
+// finding the median, 99th and 99.9th percentiles of a hundred million
+// uniform values.
+//
+// Build it in a release configuration for meaningful numbers.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stats/ExactQuantiles.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{ // unnamed namespace
+
+const std::size_t kNumberOfValues = 100000000;
+
+std::vector<float> make_values()
+{
+    std::vector<float> values(kNumberOfValues);
+    std::uint32_t state = 12345U;
+    for (float& value : values)
+    {
+        state = state * 1664525U + 1013904223U;
+        value = static_cast<float>(state >> 8U) / static_cast<float>(1U << 24U);
+    }
+    return values;
+}
+
+template <typename FunctionT>
+double seconds(const FunctionT& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+void report(const std::string& name, std::size_t operations, double elapsed)
+{
+    std::cout << name << ": " << static_cast<double>(operations) / elapsed / 1.0e6
+              << " million values per second" << std::endl;
+}
+
+} // unnamed namespace
+
+int main(int /*unused*/, char** /*unused*/)
+{
+    const std::vector<float> values         = make_values();
+    const std::vector<double> probabilities = {0.5, 0.99, 0.999};
+
+    std::vector<float> sorted_quantiles;
+    report("std::nth_element on a copy", values.size(),
+           seconds(
+               [&]()
+               {
+                   std::vector<float> copy = values;
+                   for (const double& probability : probabilities)
+                   {
+                       const std::size_t rank = static_cast<std::size_t>(
+                           probability * static_cast<double>(copy.size() - 1));
+                       std::nth_element(copy.begin(), copy.begin() + rank, copy.end());
+                       sorted_quantiles.push_back(copy[rank]);
+                   }
+               }));
+
+    stats::ExactQuantiles single_thread(1);
+    std::vector<float> quantiles;
+    report("ExactQuantiles, 1 thread", values.size(),
+           seconds([&]()
+                   { quantiles = single_thread.quantiles(values.data(), values.size(),
+                                                         probabilities); }));
+
+    stats::ExactQuantiles engine;
+    report("ExactQuantiles, all threads", values.size(),
+           seconds([&]()
+                   { quantiles = engine.quantiles(values.data(), values.size(), probabilities); }));
+    report("ExactQuantiles, all threads, reused", values.size(),
+           seconds([&]()
+                   { quantiles = engine.quantiles(values.data(), values.size(), probabilities); }));
+
+    std::cout << "p50: " << quantiles[0] << " (" << sorted_quantiles[0] << "), p99: "
+              << quantiles[1] << " (" << sorted_quantiles[1] << "), p99.9: " << quantiles[2]
+              << " (" << sorted_quantiles[2] << ")" << std::endl;
+}
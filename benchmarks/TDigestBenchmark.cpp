@@ -0,0 +1,116 @@
+// TDigestBenchmark times the t-digest against the statistics accumulator.
+// It reports the throughput of one-at-a-time and array insertion, merging,
+// quantile queries and serialization, for ten million uniform values.
+//
+// Build it in a release configuration for meaningful numbers.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stats/StatisticsAccumulator.hpp>
+#include <stats/TDigest.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{ // unnamed namespace
+
+const std::size_t kNumberOfValues = 10000000;
+
+std::vector<float> make_values()
+{
+    std::vector<float> values(kNumberOfValues);
+    std::uint32_t state = 12345U;
+    for (float& value : values)
+    {
+        state = state * 1664525U + 1013904223U;
+        value = static_cast<float>(state >> 8U) / static_cast<float>(1U << 24U);
+    }
+    return values;
+}
+
+template <typename FunctionT>
+double seconds(const FunctionT& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+void report(const std::string& name, std::size_t operations, double elapsed)
+{
+    std::cout << name << ": " << static_cast<double>(operations) / elapsed / 1.0e6
+              << " million per second" << std::endl;
+}
+
+} // unnamed namespace
+
+int main(int /*unused*/, char** /*unused*/)
+{
+    const std::vector<float> values = make_values();
+
+    stats::StatisticsAccumulator statistics;
+    report("StatisticsAccumulator::add(value)", values.size(),
+           seconds(
+               [&]()
+               {
+                   for (const float& value : values)
+                   {
+                       statistics.add(value);
+                   }
+               }));
+
+    stats::TDigest digest;
+    report("TDigest::add(value)", values.size(),
+           seconds(
+               [&]()
+               {
+                   for (const float& value : values)
+                   {
+                       digest.add(value);
+                   }
+               }));
+
+    stats::TDigest bulk_digest;
+    report("TDigest::add(values)", values.size(),
+           seconds([&]() { bulk_digest.add(values.data(), values.size()); }));
+
+    const std::size_t number_of_merges = 1000;
+    stats::TDigest merged;
+    report("TDigest::operator+=", number_of_merges,
+           seconds(
+               [&]()
+               {
+                   for (std::size_t i = 0; i < number_of_merges; ++i)
+                   {
+                       merged += digest;
+                   }
+               }));
+
+    const std::size_t number_of_queries = 1000000;
+    float sum                           = 0.F;
+    report("TDigest::quantile", number_of_queries,
+           seconds(
+               [&]()
+               {
+                   for (std::size_t i = 0; i < number_of_queries; ++i)
+                   {
+                       sum += digest.quantile(static_cast<double>(i) / number_of_queries);
+                   }
+               }));
+
+    std::string bytes;
+    report("TDigest::serialize", number_of_merges,
+           seconds(
+               [&]()
+               {
+                   for (std::size_t i = 0; i < number_of_merges; ++i)
+                   {
+                       bytes = digest.serialize();
+                   }
+               }));
+
+    std::cout << "centroids: " << digest.size() << ", serialized bytes: " << bytes.size()
+              << ", p99: " << digest.quantile(0.99) << ", checksum: " << sum << std::endl;
+}
@@ -0,0 +1,55 @@
+// FileQuantiles reports the statistics and exact quantiles of a file of raw
+// 32-bit floating point values, of any size. Run it with code like this:
+//
+//   file_quantiles_example values.f32 0.5 0.99 0.999
+//
+// The probabilities default to 0.5, 0.9, 0.99 and 0.999.
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "stats/ExactQuantiles.hpp"
+#include "stats/MappedFloatFile.hpp"
+#include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsReport.hpp"
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " FILE [PROBABILITY ...]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    stats::MappedFloatFile file(argv[1]);
+    if (!file.is_open())
+    {
+        std::cerr << argv[0] << ": cannot map " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<double> probabilities;
+    for (int i = 2; i < argc; ++i)
+    {
+        probabilities.push_back(std::atof(argv[i]));
+    }
+    if (probabilities.empty())
+    {
+        probabilities = {0.5, 0.9, 0.99, 0.999};
+    }
+
+    stats::ExactQuantiles engine;
+    stats::StatisticsAccumulator statistics;
+    const std::vector<float> quantiles =
+        engine.quantiles(file.data(), file.size(), probabilities, statistics);
+
+    std::cout << stats::description(statistics) << std::endl;
+    if (statistics.count() > 0)
+    {
+        for (std::size_t i = 0; i < probabilities.size(); ++i)
+        {
+            std::cout << " P" << probabilities[i] * 100.0 << " = " << quantiles[i] << std::endl;
+        }
+    }
+}
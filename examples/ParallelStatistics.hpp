@@ -16,23 +16,14 @@
 #include <vector>
 
 #include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsUtilities.hpp"
 
 namespace parallel_statistics
 {
 
-inline size_t number_of_threads_hint()
-{
-    size_t number_of_threads = std::thread::hardware_concurrency();
-    if (number_of_threads == 0)
-    {
-        number_of_threads = 2; // set to 2, if not detected
-    }
-    return number_of_threads;
-}
-
 inline size_t optimal_number_of_threads(size_t number_of_values)
 {
-    size_t hint = number_of_threads_hint();
+    size_t hint = stats::number_of_threads_hint();
     size_t number_of_threads =
         number_of_values < hint ? number_of_values : hint; // watch for small number of values
     return number_of_threads;
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Takes one value at a time, like StatisticsAccumulator, but updates the
+ * statistics in blocks.
+ *
+ * BufferedStatisticsAccumulator has the same add() and accessors as
+ * StatisticsAccumulator. Its add() only appends the value to a small buffer.
+ * The buffer is flushed through StatisticsAccumulator's array add() when it
+ * is full, or when flush() is called. Code that adds values one at a
+ * time gets the block update's throughput by changing only the type.
+
+ \code
+ #include <stats/BufferedStatisticsAccumulator.hpp>
+
+
+ stats::BufferedStatisticsAccumulator statistics;
+
+ for( float value : values ){
+     statistics.add( value );
+ }
+
+ float u = statistics.mean(); // includes the buffered values
+ \endcode
+
+ * The results match StatisticsAccumulator's to within rounding. Only add()
+ * and flush() change the accumulator. The accessors combine any buffered
+ * values in a copy of the statistics, so like StatisticsAccumulator's they
+ * are const and only read.
+ */
+
+class BufferedStatisticsAccumulator
+{
+  private:
+    static constexpr std::size_t kBufferSize = 64;
+
+    StatisticsAccumulator statistics_;
+    std::array<float, kBufferSize> buffer_;
+    std::size_t buffered_;
+
+  public:
+    BufferedStatisticsAccumulator();
+
+    /**
+     * Buffers the value, updating the accumulated statistics when the buffer
+     * is full.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the accumulated statistics with any buffered values.
+     */
+    void flush();
+
+    /**
+     * Returns the accumulated statistics, including any buffered values.
+     *
+     * Use the result for combining with operator+(), or for description().
+     */
+    StatisticsAccumulator statistics() const;
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the minimum of the values provided with add().
+     */
+    float minimum() const;
+
+    /**
+     * Returns the maximum of the values provided with add().
+     */
+    float maximum() const;
+
+    /**
+     * Returns the arithmetic mean of the values provided with add().
+     */
+    float mean() const;
+
+    /**
+     * Returns the mean of the absolute values provided with add().
+     */
+    float absolute_mean() const;
+
+    /**
+     * Returns the quadratic mean (rms) of the values provided with add().
+     */
+    float quadratic_mean() const;
+
+    /**
+     * Returns the standard deviation of the values provided with add().
+     */
+    float standard_deviation() const;
+
+    /**
+     * Returns the skewness of the values provided with add().
+     */
+    float skewness() const;
+
+    /**
+     * Returns the excess kurtosis of the values provided with add().
+     */
+    float kurtosis() const;
+};
+
+} // namespace stats
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, providing quantiles within a
+ * relative error.
+ *
+ * DDSketch counts values in buckets whose boundaries grow geometrically, so
+ * every returned quantile is within the relative accuracy of the true
+ * quantile, for values spanning any number of orders of magnitude. Positive
+ * and negative values have their own stores, and values near zero have a
+ * counter of their own, as do the infinities. NaN values count as zero.
+ * Sketches with the same relative accuracy combine exactly with operator+(),
+ * like StatisticsAccumulator.
+ *
+ * Use the sketch with code like the following.
+
+ \code
+ #include <stats/DDSketch.hpp>
+
+
+ stats::DDSketch sketch( 0.01 ); // within 1%
+
+ sketch.add( value );
+ sketch.add( values, number_of_values );
+
+ float p99 = sketch.quantile( 0.99 );
+
+ stats::DDSketch combined = sketch1 + sketch2;
+ \endcode
+
+ * Each store holds at most max_bins buckets. When a store's range of buckets
+ * grows past the limit, its lowest buckets collapse in to one, giving up
+ * accuracy for the values nearest zero first.
+ *
+ * \sa
+ * <a href="https://arxiv.org/abs/1908.10693">
+ * DDSketch: A Fast and Fully-Mergeable Quantile Sketch with Relative-Error
+ * Guarantees.
+ * </a>
+ * Charles Masson, Jee Rim and Homin Lee's sketch, with the logarithmic
+ * mapping and collapsing-lowest dense stores.
+ */
+
+class DDSketch
+{
+  private:
+    class Store
+    {
+      private:
+        std::vector<std::uint64_t> counts_;
+        std::int32_t offset_;
+
+      public:
+        Store();
+
+        void add(std::int32_t index, const std::uint64_t& count, const std::size_t& max_bins);
+        bool empty() const;
+        std::size_t size() const;
+        std::int32_t lowest_index() const;
+        std::uint64_t count(const std::int32_t& index) const;
+    };
+
+    double relative_accuracy_;
+    double gamma_, log_gamma_;
+    std::size_t max_bins_;
+    Store positive_, negative_;
+    std::uint64_t zero_count_;
+    std::uint64_t negative_infinities_, positive_infinities_;
+    std::uint64_t count_;
+    float minimum_, maximum_;
+
+    std::int32_t index(const float& magnitude) const;
+    float value(const std::int32_t& index) const;
+    void add(const float& value, const std::uint64_t& count);
+
+  public:
+    /**
+     * Makes a sketch with the specified relative accuracy, between 0 and 1,
+     * and at most max_bins buckets for each sign.
+     */
+    explicit DDSketch(double relative_accuracy = 0.01, std::size_t max_bins = 2048);
+
+    /**
+     * Updates the sketch with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the sketch with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of buckets in use.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the relative accuracy of the quantiles.
+     */
+    double relative_accuracy() const;
+
+    /**
+     * Returns the estimate of the quantile with the specified probability.
+     *
+     * Probabilities 0 and 1 give the exact minimum and maximum. Returns the
+     * undefined-value marker when no values were added.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * "Adds" sketches, aggregating the results.
+     *
+     * The result has this sketch's accuracy. Counts from a sketch with a
+     * different accuracy are re-added at their bucket values.
+     */
+    DDSketch operator+(const DDSketch& that) const;
+
+    /**
+     * "Adds" the specified sketch to this one, aggregating the results.
+     */
+    DDSketch& operator+=(const DDSketch& rhs);
+};
+
+} // namespace stats
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Weighs timestamped values in log-linear buckets, providing percentiles in
+ * which older values count for less.
+ *
+ * DecayedHistogram has LogLinearHistogram's buckets, holding weights instead
+ * of counts. Each value's weight halves for every half-life that passes
+ * after its timestamp, so the percentiles follow recent data without a hard
+ * window. Timestamps are in any unit, the same as the half-life.
+ *
+ * Use the histogram with code like the following.
+
+ \code
+ #include <stats/DecayedHistogram.hpp>
+
+
+ // milliseconds to 100 seconds, within 1%, with a half-life of a minute
+
+ stats::DecayedHistogram latencies( 60.0, 1.0, 1.0e5, 7 );
+
+ latencies.record( now_s, milliseconds );
+ latencies.record( now_s, values, number_of_values );
+
+ float p99 = latencies.quantile( 0.99 );
+ \endcode
+
+ * Pair it with an ExponentialStatisticsAccumulator of the same half-life for
+ * decayed moments, and describe both with description().
+ *
+ * The decay is forward: a value's weight is fixed when it is recorded, as 2
+ * to the power of its age past a landmark time, in half-lives, and only
+ * ratios of weights matter for the percentiles. Recording is O(1), with no
+ * pass over the buckets. Those weights grow without bound, so once they
+ * reach 2^512 the landmark moves up to the latest timestamp and every weight
+ * is scaled down to match, an occasional pass over the buckets.
+ *
+ * \sa
+ * <a href="https://dimacs.rutgers.edu/~graham/pubs/papers/fwddecay.pdf">
+ * Forward decay: a practical time decay model for streaming systems.
+ * </a>
+ * The weights follow Cormode, Shkapenyuk, Srivastava and Xu's forward decay,
+ * with an exponential decay function.
+ */
+
+class DecayedHistogram
+{
+  private:
+    double half_life_;
+    unsigned precision_bits_;
+    std::int32_t lowest_key_, highest_key_;
+    std::vector<double> weights_;
+    double landmark_;
+    double latest_;
+    double total_;
+    std::uint64_t count_;
+    float minimum_, maximum_;
+
+    double forward_weight(const double& timestamp);
+    void move_landmark(const double& landmark);
+    void record(const float& value, const double& weight);
+
+  public:
+    /**
+     * Makes a histogram whose weights halve every half_life, for values from
+     * lowest to highest, both positive, with the specified bits of precision,
+     * from 1 to 23.
+     */
+    DecayedHistogram(double half_life, float lowest, float highest, unsigned precision_bits = 7);
+
+    /**
+     * Weighs the value at the specified time.
+     *
+     * Timestamps may arrive out of order. Each value gets the weight it
+     * would have had in order.
+     */
+    void record(const double& timestamp, const float& value);
+
+    /**
+     * Weighs an array of values, all at the specified time.
+     */
+    void record(const double& timestamp, const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the half-life.
+     */
+    double half_life() const;
+
+    /**
+     * Returns the latest timestamp recorded.
+     */
+    double time() const;
+
+    /**
+     * Returns the landmark time the weights are measured from.
+     */
+    double landmark() const;
+
+    /**
+     * Returns the sum of the weights of the values, decayed to the latest
+     * timestamp.
+     */
+    double weight() const;
+
+    /**
+     * Returns the total number of values recorded.
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of buckets.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the decayed quantile with the specified probability, as the
+     * middle of its bucket.
+     *
+     * Returns the undefined-value marker when no values were recorded.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * "Adds" histograms, aggregating the decayed weights.
+     *
+     * The result has this histogram's half-life and buckets, and the later
+     * of the two landmarks. Weights from a histogram with different buckets
+     * are re-recorded at their bucket middles.
+     */
+    DecayedHistogram operator+(const DecayedHistogram& that) const;
+
+    /**
+     * "Adds" the specified histogram to this one, aggregating the results.
+     */
+    DecayedHistogram& operator+=(const DecayedHistogram& rhs);
+};
+
+} // namespace stats
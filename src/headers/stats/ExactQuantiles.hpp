@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+class StatisticsAccumulator;
+
+/**
+ * Finds exact quantiles of arrays of values in memory, in parallel.
+ *
+ * ExactQuantiles selects by radix on the bit patterns of the values, mapped
+ * so their unsigned order is the numerical order. A first pass over the
+ * array counts the high 16 bits, in one histogram per thread. That locates
+ * the bucket holding each required rank. A second pass counts the low 16
+ * bits of just the values in those buckets, which gives the exact values.
+ * Every requested quantile comes from the same two passes, and the array is
+ * neither copied nor changed.
+ *
+ * Use the engine with code like the following.
+
+ \code
+ #include <stats/ExactQuantiles.hpp>
+
+
+ stats::ExactQuantiles engine;
+
+ float median = engine.median( values, number_of_values );
+
+ std::vector<float> q = engine.quantiles( values, number_of_values, { 0.5, 0.99, 0.999 } );
+ \endcode
+
+ * Quantiles interpolate linearly between the values at the closest ranks,
+ * like the default of R and NumPy. The histograms are a scratch arena kept
+ * between calls, so an engine reused for many arrays allocates once. An
+ * engine is for one thread at a time. NaN values sort beyond the infinity of
+ * the same sign.
+ *
+ * Both passes stream through the array in order, so it may be a
+ * MappedFloatFile far larger than the memory. The first pass can also
+ * accumulate the StatisticsAccumulator moments, saving a third pass.
+ */
+
+class ExactQuantiles
+{
+  private:
+    std::size_t number_of_threads_;
+    std::vector<std::uint64_t> histograms_;
+    std::vector<std::uint8_t> slots_;
+
+    std::vector<float> select(const float* values, std::size_t number_of_values,
+                              const std::vector<double>& probabilities,
+                              StatisticsAccumulator* statistics);
+
+  public:
+    /**
+     * Makes an engine using up to the specified number of threads, or the
+     * hardware concurrency for 0.
+     */
+    explicit ExactQuantiles(std::size_t number_of_threads = 0);
+
+    /**
+     * Returns the exact quantiles of the values with the specified
+     * probabilities.
+     *
+     * Returns undefined-value markers when there are no values, and for NaN
+     * probabilities.
+     */
+    std::vector<float> quantiles(const float* values, std::size_t number_of_values,
+                                 const std::vector<double>& probabilities);
+
+    /**
+     * Returns the exact quantiles of the values with the specified
+     * probabilities, and adds the values to the statistics in the same pass.
+     */
+    std::vector<float> quantiles(const float* values, std::size_t number_of_values,
+                                 const std::vector<double>& probabilities,
+                                 StatisticsAccumulator& statistics);
+
+    /**
+     * Returns the exact quantile of the values with the specified
+     * probability.
+     */
+    float quantile(const float* values, std::size_t number_of_values, const double& probability);
+
+    /**
+     * Returns the exact median of the values.
+     */
+    float median(const float* values, std::size_t number_of_values);
+};
+
+} // namespace stats
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, providing statistics in which
+ * older values count for less.
+ *
+ * Each value's weight halves for every half-life that passes after it. Time
+ * advances one tick per value by default, or by the gap between timestamps
+ * when values carry them, so irregular sampling is weighted exactly. Every
+ * update costs O(1). The accessors have StatisticsAccumulator's names, and
+ * description() takes either accumulator.
+ *
+ * Use the accumulator with code like the following.
+
+ \code
+ #include <stats/ExponentialStatisticsAccumulator.hpp>
+
+
+ stats::ExponentialStatisticsAccumulator recent( 100.0 ); // half-life of 100 values
+
+ recent.add( value );
+ recent.add( values, number_of_values );
+
+ float u = recent.mean();
+ float s = recent.standard_deviation();
+ \endcode
+
+ * The moments are weighted sums, updated with the weighted form of the
+ * StatisticsAccumulator combination. The array add() weights each block in
+ * two vectorizable passes over independent lanes, then combines the block
+ * in one step. The count, minimum and maximum cover every value added,
+ * without decay.
+ */
+
+class ExponentialStatisticsAccumulator
+{
+  private:
+    // the weighted forms of StatisticsAccumulator's moments
+    struct WeightedMoments
+    {
+        double weight, moment1, abs_moment1, moment2, moment3, moment4;
+    };
+
+    double half_life_;
+    double decay_per_tick_;
+    double time_;
+
+    std::size_t count_;
+    float minimum_, maximum_;
+    WeightedMoments moments_;
+
+    void decay(const double& factor);
+    void combine(const WeightedMoments& that);
+
+  public:
+    /**
+     * Makes an accumulator whose weights halve every half_life ticks.
+     */
+    explicit ExponentialStatisticsAccumulator(double half_life);
+
+    /**
+     * Updates the statistics with the value, one tick after the last.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the statistics with the value at the specified time, in ticks.
+     *
+     * Time moves forward to the timestamp. A timestamp before the latest one
+     * gives the value the weight it would have had if added in order.
+     */
+    void add(const double& timestamp, const float& value);
+
+    /**
+     * Updates the statistics with an array of values, one tick apart.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the half-life, in ticks.
+     */
+    double half_life() const;
+
+    /**
+     * Returns the time of the latest value, in ticks.
+     */
+    double time() const;
+
+    /**
+     * Returns the sum of the current weights of the values.
+     */
+    double weight() const;
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the minimum of the values provided with add().
+     */
+    float minimum() const;
+
+    /**
+     * Returns the maximum of the values provided with add().
+     */
+    float maximum() const;
+
+    /**
+     * Returns the weighted arithmetic mean of the values.
+     */
+    float mean() const;
+
+    /**
+     * Returns the weighted mean of the absolute values.
+     */
+    float absolute_mean() const;
+
+    /**
+     * Returns the weighted quadratic mean (rms) of the values.
+     */
+    float quadratic_mean() const;
+
+    /**
+     * Returns the weighted standard deviation of the values.
+     */
+    float standard_deviation() const;
+
+    /**
+     * Returns the weighted skewness of the values.
+     */
+    float skewness() const;
+
+    /**
+     * Returns the weighted excess kurtosis of the values.
+     */
+    float kurtosis() const;
+};
+
+} // namespace stats
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * A value tracked by a FrequentValuesSketch, with its estimated count.
+ *
+ * The true count is between count - error and count.
+ */
+struct FrequentValue
+{
+    float value;
+    std::uint64_t count;
+    std::uint64_t error;
+};
+
+/**
+ * Takes values one at a time or in arrays, tracking the most frequent values
+ * in fixed memory.
+ *
+ * FrequentValuesSketch is a Space-Saving summary of capacity values. A value
+ * already tracked gets its count incremented. A new value replaces the value
+ * with the lowest count, inheriting that count as its error. Every value
+ * occurring more than count()/capacity() times is tracked, and no estimated
+ * count is more than count()/capacity() too high. Sketches combine with
+ * operator+() like StatisticsAccumulator.
+ *
+ * Use the sketch with code like the following.
+
+ \code
+ #include <stats/FrequentValuesSketch.hpp>
+
+
+ stats::FrequentValuesSketch sketch( 256 );
+
+ sketch.add( value );
+ sketch.add( values, number_of_values );
+
+ for ( const stats::FrequentValue& frequent : sketch.top( 10 ) )
+ {
+     // frequent.value occurred about frequent.count times
+ }
+ \endcode
+
+ * The tracked values are a min-heap on count, in separate arrays of keys and
+ * counts, with an open-addressing index from key to heap position. Finding,
+ * counting and replacing a value touch a few contiguous cache lines, rather
+ * than the linked buckets of the original stream-summary. The values 0 and -0
+ * count as one value, as do all NaN values.
+ *
+ * \sa
+ * <a href="https://doi.org/10.1007/978-3-540-30570-5_27">
+ * Efficient Computation of Frequent and Top-k Elements in Data Streams.
+ * </a>
+ * Ahmed Metwally, Divyakant Agrawal and Amr El Abbadi's algorithm, combined
+ * with the merge of Agarwal et al.'s Mergeable Summaries.
+ */
+
+class FrequentValuesSketch
+{
+  private:
+    std::size_t capacity_;
+
+    // heap of tracked values, smallest count first
+    std::vector<std::uint32_t> keys_;
+    std::vector<std::uint64_t> counts_;
+    std::vector<std::uint64_t> errors_;
+    std::vector<std::uint32_t> slots_;
+
+    // index from key to heap position, -1 for empty slots
+    std::vector<std::int32_t> index_;
+    std::uint32_t index_bits_;
+
+    std::uint64_t count_;
+
+    std::size_t home(const std::uint32_t& key) const;
+    std::size_t find(const std::uint32_t& key) const;
+    void insert(const std::size_t& slot, const std::size_t& position);
+    void erase(std::size_t slot);
+    void swap(const std::size_t& a, const std::size_t& b);
+    void sift_down(std::size_t position);
+    void sift_up(std::size_t position);
+    void add(const std::uint32_t& key, const std::uint64_t& count);
+
+  public:
+    /**
+     * Makes a sketch tracking at most the specified number of values.
+     */
+    explicit FrequentValuesSketch(std::size_t capacity = 256);
+
+    /**
+     * Updates the sketch with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the sketch with an array of values.
+     *
+     * Each run of equal values makes one update of the summary.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the estimated count of the value, or 0 when it is not tracked.
+     */
+    std::uint64_t count(const float& value) const;
+
+    /**
+     * Returns the number of values tracked.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the maximum number of values tracked.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Returns up to the specified number of tracked values, most frequent
+     * first.
+     */
+    std::vector<FrequentValue> top(std::size_t number_of_values) const;
+
+    /**
+     * "Adds" sketches, aggregating the results.
+     *
+     * The result has this sketch's capacity. A value tracked by only one
+     * sketch gets the other sketch's lowest count, if it is full, added to
+     * both its count and its error.
+     */
+    FrequentValuesSketch operator+(const FrequentValuesSketch& that) const;
+
+    /**
+     * "Adds" the specified sketch to this one, aggregating the results.
+     */
+    FrequentValuesSketch& operator+=(const FrequentValuesSketch& rhs);
+};
+
+} // namespace stats
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, counting them in equal-width bins
+ * over a range known up front.
+ *
+ * Use the histogram with code like the following.
+
+ \code
+ #include <stats/HistogramAccumulator.hpp>
+
+
+ stats::HistogramAccumulator histogram( 0.F, 100.F, 50 ); // 2-unit bins
+
+ histogram.add( value );
+ histogram.add( values, number_of_values );
+
+ uint64_t in_first_bin = histogram.count( 0 );
+ uint64_t too_high     = histogram.overflow();
+
+ stats::HistogramAccumulator combined = histogram1 + histogram2;
+ \endcode
+
+ * Bins include their lower bound and exclude their upper bound. Values below
+ * the range, and NaN values, count as underflow. Values at or above the upper
+ * bound count as overflow.
+ *
+ * The array add() computes the bin indexes of a block of values in one
+ * vectorizable loop, then counts them in kLanes interleaved sub-histograms,
+ * so runs of values in the same bin do not wait on each other's counter
+ * updates. The sub-histograms are summed when read.
+ */
+
+class HistogramAccumulator
+{
+  private:
+    static constexpr std::size_t kLanes = 4;
+
+    float lower_, upper_;
+    float bins_per_unit_;
+    std::size_t number_of_bins_;
+
+    // kLanes sub-histograms, each with an underflow slot, the bins and an
+    // overflow slot
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_;
+
+    std::int32_t slot(const float& value) const;
+    std::uint64_t slot_count(const std::size_t& slot) const;
+
+  public:
+    /**
+     * Makes a histogram of the specified number of equal-width bins spanning
+     * lower to upper.
+     */
+    HistogramAccumulator(float lower, float upper, std::size_t number_of_bins);
+
+    /**
+     * Updates the histogram with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the histogram with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add(), including the
+     * underflow and overflow.
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of values in the specified bin.
+     */
+    std::uint64_t count(const std::size_t& bin) const;
+
+    /**
+     * Returns the number of values below the range, or NaN.
+     */
+    std::uint64_t underflow() const;
+
+    /**
+     * Returns the number of values at or above the upper bound of the range.
+     */
+    std::uint64_t overflow() const;
+
+    /**
+     * Returns the number of bins.
+     */
+    std::size_t number_of_bins() const;
+
+    /**
+     * Returns the lower bound of the specified bin. Bin number_of_bins() gives
+     * the upper bound of the range.
+     */
+    float lower_bound(const std::size_t& bin) const;
+
+    /**
+     * "Adds" histograms, aggregating the results.
+     *
+     * The result has this histogram's bins. Counts from a histogram with
+     * different bins are re-counted at their bin midpoints.
+     */
+    HistogramAccumulator operator+(const HistogramAccumulator& that) const;
+
+    /**
+     * "Adds" the specified histogram to this one, aggregating the results.
+     */
+    HistogramAccumulator& operator+=(const HistogramAccumulator& rhs);
+};
+
+} // namespace stats
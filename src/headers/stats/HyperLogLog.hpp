@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, estimating the number of distinct
+ * values in fixed memory.
+ *
+ * HyperLogLog hashes the bit pattern of each value, using the first bits of
+ * the hash to pick a register and keeping the longest run of leading zeros
+ * seen in the remaining bits. With precision p, the estimator keeps 2^p
+ * one-byte registers and has a relative standard error of about 1.04/2^(p/2),
+ * 0.8% for the default of 14.
+ *
+ * Use the estimator with code like the following.
+
+ \code
+ #include <stats/HyperLogLog.hpp>
+
+
+ stats::HyperLogLog distinct;
+
+ distinct.add( value );
+ distinct.add( values, number_of_values );
+
+ double n = distinct.cardinality();
+
+ stats::HyperLogLog combined = distinct1 + distinct2; // union of the streams
+ \endcode
+
+ * The values 0 and -0 count as one value, and all NaN values count as one
+ * value.
+ *
+ * \sa
+ * <a href="https://arxiv.org/abs/1702.01284">
+ * New cardinality estimation algorithms for HyperLogLog sketches.
+ * </a>
+ * Otmar Ertl's improved estimator, which needs no empirical bias correction
+ * at any cardinality.
+ */
+
+class HyperLogLog
+{
+  private:
+    std::size_t precision_;
+    std::vector<std::uint8_t> registers_;
+
+    void add_hash(const std::uint64_t& hash);
+
+  public:
+    /**
+     * Makes an estimator with 2^precision registers. The precision is limited
+     * to the range 4 to 18.
+     */
+    explicit HyperLogLog(std::size_t precision = 14);
+
+    /**
+     * Updates the estimator with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the estimator with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the estimate of the number of distinct values.
+     */
+    double cardinality() const;
+
+    /**
+     * Returns the number of bits choosing a register.
+     */
+    std::size_t precision() const;
+
+    /**
+     * Returns the relative standard error of cardinality().
+     */
+    double relative_standard_error() const;
+
+    /**
+     * "Adds" estimators, estimating the distinct values in both streams.
+     *
+     * The result has the lower precision of the two.
+     */
+    HyperLogLog operator+(const HyperLogLog& that) const;
+
+    /**
+     * "Adds" the specified estimator to this one.
+     */
+    HyperLogLog& operator+=(const HyperLogLog& rhs);
+};
+
+} // namespace stats
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Accumulates statistics from several writer threads, in intervals collected
+ * by an exporter thread.
+ *
+ * IntervalStatisticsAccumulator gives each writer its own slot. A writer
+ * calls add() with its slot number. The exporter calls snapshot_and_reset()
+ * once per interval, for example once per second, and receives the combined
+ * statistics of every value added since its previous call.
+ *
+ * Use the accumulator with code like the following.
+
+ \code
+ #include <stats/IntervalStatisticsAccumulator.hpp>
+
+
+ stats::IntervalStatisticsAccumulator intervals( number_of_writers );
+
+ // in writer thread i
+
+ intervals.add( i, value );
+
+ // in the exporter thread, once per interval
+
+ stats::StatisticsAccumulator statistics = intervals.snapshot_and_reset();
+ \endcode
+
+ * Each slot holds two accumulators, one per epoch. Writers add to the current
+ * epoch. The exporter flips the epoch, waits only for writes already in
+ * progress to finish, then drains and resets the previous epoch. Writers
+ * never wait for the exporter.
+ */
+
+class IntervalStatisticsAccumulator
+{
+  private:
+    struct alignas(64) Slot
+    {
+        std::atomic<bool> busy[2];
+        StatisticsAccumulator statistics[2];
+
+        Slot();
+    };
+
+    std::vector<Slot> slots_;
+    std::atomic<unsigned> epoch_;
+    std::mutex exporter_mutex_;
+
+    template <typename AddT>
+    void add_in_current_epoch(Slot& slot, const AddT& add);
+
+  public:
+    /**
+     * Makes an accumulator for the specified number of writer slots.
+     */
+    explicit IntervalStatisticsAccumulator(std::size_t number_of_writers);
+
+    /**
+     * Updates the writer's slot with the value.
+     *
+     * Each writer slot must be used by one thread at a time.
+     */
+    void add(std::size_t writer, const float& value);
+
+    /**
+     * Updates the writer's slot with an array of values.
+     */
+    void add(std::size_t writer, const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the combined statistics of all the values added since the
+     * previous call, and starts a new interval.
+     */
+    StatisticsAccumulator snapshot_and_reset();
+};
+
+} // namespace stats
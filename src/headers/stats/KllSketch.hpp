@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, providing quantiles with a
+ * guaranteed rank error.
+ *
+ * KllSketch keeps a hierarchy of compactors. Each compactor sorts its values
+ * and promotes a random half of them, with double weight, to the compactor
+ * above. Whatever the order of the input values, the rank of every returned
+ * quantile is within normalized_rank_error() of the requested probability,
+ * with 99% confidence. Sketches combine with operator+() like
+ * StatisticsAccumulator.
+ *
+ * The memory is O(k + log n) for n values, not fixed. It is about 3 k
+ * values, plus two per doubling of n beyond k, since every compactor keeps a
+ * capacity of at least two. That is about 50 more values at four billion.
+ * The paper caps the hierarchy by folding the lowest levels in to a sampler.
+ * This sketch keeps the simpler hierarchy instead, since the extra values
+ * are few.
+ *
+ * Use the sketch with code like the following.
+
+ \code
+ #include <stats/KllSketch.hpp>
+
+
+ stats::KllSketch sketch( 200 );
+
+ sketch.add( value );
+ sketch.add( values, number_of_values );
+
+ float p99 = sketch.quantile( 0.99 ); // rank within 1.3% of 0.99
+ \endcode
+
+ * \sa
+ * <a href="https://arxiv.org/abs/1603.05346">
+ * Optimal Quantile Approximation in Streams.
+ * </a>
+ * Zohar Karnin, Kevin Lang and Edo Liberty's sketch, with compactor
+ * capacities shrinking by 2/3 per level below the top.
+ */
+
+class KllSketch
+{
+  private:
+    std::size_t k_;
+    std::vector<std::vector<float>> compactors_;
+    std::size_t size_, max_size_;
+    std::uint64_t count_;
+    std::uint64_t random_state_;
+
+    std::size_t capacity(std::size_t level) const;
+    void grow();
+    void compress();
+    bool coin_flip();
+
+  public:
+    /**
+     * Makes a sketch with the specified accuracy parameter.
+     *
+     * Larger k gives smaller rank errors, and uses more memory.
+     */
+    explicit KllSketch(std::size_t k = 200, std::uint64_t seed = 1);
+
+    /**
+     * Updates the sketch with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the sketch with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of values retained by the sketch.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the bound on the difference between the requested and actual
+     * normalized rank of a quantile, with 99% confidence.
+     */
+    double normalized_rank_error() const;
+
+    /**
+     * Returns the fraction of the values less than or equal to the value.
+     */
+    double rank(const float& value) const;
+
+    /**
+     * Returns the smallest retained value whose rank is at least the
+     * probability.
+     *
+     * Returns the undefined-value marker when no values were added.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * "Adds" sketches, aggregating the results.
+     *
+     * The result has the smaller, less accurate, k of the two.
+     */
+    KllSketch operator+(const KllSketch& that) const;
+
+    /**
+     * "Adds" the specified sketch to this one, aggregating the results.
+     */
+    KllSketch& operator+=(const KllSketch& rhs);
+};
+
+} // namespace stats
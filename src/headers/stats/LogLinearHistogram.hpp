@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Counts values in log-linear buckets, providing percentiles with a fixed
+ * relative precision.
+ *
+ * LogLinearHistogram suits positive, latency-like values spanning many
+ * orders of magnitude. Each power of two between the lowest and highest
+ * trackable values is split in to 2^precision_bits equal buckets, so every
+ * quantile is within a relative error of 2^-precision_bits. record() is a few
+ * integer operations on the value's bits, and the memory is fixed at
+ * construction. Values at or below the lowest trackable value, including zero
+ * and negative values, count in the lowest bucket. Values above the highest
+ * count in the highest bucket.
+ *
+ * Use the histogram with code like the following.
+
+ \code
+ #include <stats/LogLinearHistogram.hpp>
+
+
+ // nanoseconds to 100 seconds, within 1%
+
+ stats::LogLinearHistogram latencies( 1.0, 1.0e11, 7 );
+
+ latencies.record( nanoseconds );
+ latencies.record( values, number_of_values );
+
+ float p999 = latencies.quantile( 0.999 );
+ \endcode
+
+ * \sa
+ * <a href="http://hdrhistogram.org/">HdrHistogram.</a>
+ * The bucket layout follows Gil Tene's High Dynamic Range histogram, keyed
+ * by the float's exponent and leading mantissa bits.
+ */
+
+class LogLinearHistogram
+{
+  private:
+    unsigned precision_bits_;
+    std::int32_t lowest_key_, highest_key_;
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_;
+    float minimum_, maximum_;
+
+    void record(const float& value, const std::uint64_t& count);
+
+  public:
+    /**
+     * Makes a histogram for values from lowest to highest, both positive,
+     * with the specified bits of precision, from 1 to 23.
+     */
+    LogLinearHistogram(float lowest, float highest, unsigned precision_bits = 7);
+
+    /**
+     * Counts the value.
+     */
+    void record(const float& value);
+
+    /**
+     * Counts an array of values.
+     */
+    void record(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values recorded.
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of buckets.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the minimum recorded value.
+     */
+    float minimum() const;
+
+    /**
+     * Returns the maximum recorded value.
+     */
+    float maximum() const;
+
+    /**
+     * Returns the quantile with the specified probability, as the middle of
+     * its bucket. Probabilities 0 and 1 give the exact minimum and maximum.
+     *
+     * Returns the undefined-value marker when no values were recorded, or for
+     * a NaN probability.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * "Adds" histograms, aggregating the results.
+     *
+     * The result has this histogram's buckets. Counts from a histogram with
+     * different buckets are re-recorded at their bucket middles.
+     */
+    LogLinearHistogram operator+(const LogLinearHistogram& that) const;
+
+    /**
+     * "Adds" the specified histogram to this one, aggregating the results.
+     */
+    LogLinearHistogram& operator+=(const LogLinearHistogram& rhs);
+};
+
+} // namespace stats
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace stats
+{
+
+/**
+ * Maps a file of raw 32-bit floating point values in to memory, read only.
+ *
+ * The operating system pages the values in as they are read, and drops them
+ * again under memory pressure, so arrays far larger than the memory can pass
+ * through the array functions of the accumulators and engines. The file
+ * stays mapped for the lifetime of the object.
+ *
+ * Use the mapped file with code like the following.
+
+ \code
+ #include <stats/ExactQuantiles.hpp>
+ #include <stats/MappedFloatFile.hpp>
+ #include <stats/StatisticsAccumulator.hpp>
+
+
+ stats::MappedFloatFile file( "values.f32" );
+ if ( file.is_open() )
+ {
+     stats::ExactQuantiles engine;
+     stats::StatisticsAccumulator statistics;
+     std::vector<float> q = engine.quantiles( file.data(), file.size(), { 0.5, 0.99 }, statistics );
+ }
+ \endcode
+
+ * The values are in the byte order of the machine. Any bytes after the last
+ * whole value are ignored.
+ */
+
+class MappedFloatFile
+{
+  private:
+    void* mapping_;
+    std::size_t mapped_bytes_;
+    std::size_t size_;
+    bool open_;
+
+  public:
+    /**
+     * Maps the file at the specified path. Check is_open() for success.
+     */
+    explicit MappedFloatFile(const std::string& path);
+
+    ~MappedFloatFile();
+
+    MappedFloatFile(const MappedFloatFile&)            = delete;
+    MappedFloatFile& operator=(const MappedFloatFile&) = delete;
+
+    /**
+     * Returns true when the file was mapped.
+     */
+    bool is_open() const;
+
+    /**
+     * Returns the mapped values, or nullptr for an empty or unmapped file.
+     */
+    const float* data() const;
+
+    /**
+     * Returns the number of whole values in the file.
+     */
+    std::size_t size() const;
+};
+
+} // namespace stats
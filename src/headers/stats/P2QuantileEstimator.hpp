@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes one value at a time, providing estimates of the median and other
+ * quantiles in constant memory.
+ *
+ * P2QuantileEstimator accepts 32-bit floating point values with add(), like
+ * StatisticsAccumulator, and runs alongside it. It does not store the values.
+ * It keeps two markers per requested quantile, plus three, whatever the number
+ * of values. The default estimator tracks the median with five markers.
+ *
+ * Use the estimator with code like the following.
+
+ \code
+ #include <stats/P2QuantileEstimator.hpp>
+
+
+ stats::P2QuantileEstimator quantiles( { 0.5F, 0.9F, 0.99F } );
+
+ quantiles.add( value );
+ ...
+
+ float median = quantiles.quantile( 0.5F );
+ float p99    = quantiles.quantile( 0.99F );
+ \endcode
+
+ * The estimates are exact until the estimator has seen more values than it
+ * has markers. After that, the markers' heights follow piecewise-parabolic
+ * interpolation of the distribution.
+ *
+ * \sa
+ * <a href="https://www.cse.wustl.edu/~jain/papers/ftp/psqr.pdf">
+ * The P-Square Algorithm for Dynamic Calculation of Percentiles and Histograms
+ * without Storing Observations.
+ * </a>
+ * Raj Jain and Imrich Chlamtac's algorithm, with Kimmo Raatikainen's extension
+ * to several quantiles.
+ */
+
+class P2QuantileEstimator
+{
+  private:
+    std::vector<float> probabilities_;
+    std::vector<double> heights_;
+    std::vector<double> positions_;
+    std::vector<double> desired_positions_;
+    std::vector<double> increments_;
+    std::size_t count_;
+
+    void adjust(std::size_t marker);
+
+  public:
+    /**
+     * Makes an estimator for the specified quantile probabilities, each
+     * between 0 and 1.
+     */
+    explicit P2QuantileEstimator(const std::vector<float>& probabilities = {0.5F});
+
+    /**
+     * Updates the quantile estimates with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the estimate of the quantile with the specified probability.
+     *
+     * Returns the undefined-value marker when no values were added, or when
+     * the estimator was not made for the probability.
+     */
+    float quantile(const float& probability) const;
+
+    /**
+     * Returns the estimate of the median.
+     *
+     * Returns the undefined-value marker when no values were added, or when
+     * the estimator was not made for the median.
+     */
+    float median() const;
+};
+
+} // namespace stats
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Indexes an array of values, providing the statistics of any range of it
+ * without rescanning the range.
+ *
+ * RangeStatisticsIndex accumulates the statistics of each fixed-size block of
+ * the array, in parallel, and builds a segment tree of the blocks combined
+ * with operator+(). A range query combines O(log n) tree nodes for the whole
+ * blocks in the range, and scans only the partial blocks at its ends.
+ *
+ * Use the index with code like the following.
+
+ \code
+ #include <stats/RangeStatisticsIndex.hpp>
+
+
+ stats::RangeStatisticsIndex index( values, number_of_values );
+
+ stats::StatisticsAccumulator statistics = index.statistics( begin, end );
+ \endcode
+
+ * The index holds two accumulators per block, so the block size trades the
+ * memory of the index against the length of the end scans. The index keeps
+ * a pointer to the values, which must outlive it and stay unchanged.
+ */
+
+class RangeStatisticsIndex
+{
+  private:
+    const float* values_;
+    std::size_t number_of_values_;
+    std::size_t block_size_;
+    std::size_t number_of_blocks_;
+    std::vector<StatisticsAccumulator> tree_;
+
+  public:
+    /**
+     * Indexes the values in blocks of the specified size, using up to the
+     * specified number of threads, or the hardware concurrency for 0.
+     */
+    RangeStatisticsIndex(const float* values, std::size_t number_of_values,
+                         std::size_t block_size = 4096, std::size_t number_of_threads = 0);
+
+    /**
+     * Returns the statistics of the values from begin up to, but excluding,
+     * end.
+     *
+     * The range is clipped to the array.
+     */
+    StatisticsAccumulator statistics(std::size_t begin, std::size_t end) const;
+
+    /**
+     * Returns the number of indexed values.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the number of values per block.
+     */
+    std::size_t block_size() const;
+
+    /**
+     * Returns the number of blocks.
+     */
+    std::size_t number_of_blocks() const;
+};
+
+} // namespace stats
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, keeping a uniform random sample
+ * of fixed size.
+ *
+ * After any number of values, every value has the same chance of being in
+ * the sample. Use the sample for plots and ad-hoc measures alongside the
+ * StatisticsAccumulator moments.
+ *
+ * Use the sampler with code like the following.
+
+ \code
+ #include <stats/ReservoirSampler.hpp>
+
+
+ stats::ReservoirSampler sampler( 1000 );
+
+ sampler.add( value );
+ sampler.add( values, number_of_values );
+
+ const std::vector<float>& sample = sampler.sample();
+
+ stats::ReservoirSampler combined = sampler1 + sampler2;
+ \endcode
+
+ * Once the sample is full, the sampler draws how many values to skip before
+ * the next replacement, so the work per value falls as the stream grows. The
+ * array add() jumps straight over the skipped values.
+ *
+ * \sa
+ * <a href="https://doi.org/10.1145/198429.198435">
+ * Reservoir-sampling algorithms of time complexity O(n(1 + log(N/n))).
+ * </a>
+ * Kim-Hung Li's Algorithm L.
+ */
+
+class ReservoirSampler
+{
+  private:
+    std::size_t capacity_;
+    std::vector<float> sample_;
+    std::uint64_t count_;
+
+    // Algorithm L state: the largest kept key, and the count at which the
+    // next value replaces a sampled one
+    double threshold_;
+    std::uint64_t next_;
+
+    std::uint64_t random_state_;
+
+    std::uint64_t random();
+    double uniform();
+    std::size_t uniform_index(std::size_t size);
+    void start_skipping(double threshold);
+    void skip();
+
+  public:
+    /**
+     * Makes a sampler keeping at most the specified number of values.
+     */
+    explicit ReservoirSampler(std::size_t capacity = 1024, std::uint64_t seed = 1);
+
+    /**
+     * Offers the value to the sample.
+     */
+    void add(const float& value);
+
+    /**
+     * Offers an array of values to the sample.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the maximum number of values in the sample.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Returns the sampled values, in no particular order.
+     */
+    const std::vector<float>& sample() const;
+
+    /**
+     * "Adds" samplers, making a uniform sample of both streams.
+     *
+     * The result has this sampler's capacity. The number of values it takes
+     * from each sample follows the hypergeometric distribution of the two
+     * stream counts.
+     */
+    ReservoirSampler operator+(const ReservoirSampler& that) const;
+
+    /**
+     * "Adds" the specified sampler to this one.
+     */
+    ReservoirSampler& operator+=(const ReservoirSampler& rhs);
+};
+
+} // namespace stats
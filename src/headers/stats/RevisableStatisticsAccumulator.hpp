@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time, providing accumulated descriptive statistics
+ * that stay correct when values are later removed or corrected.
+ *
+ * RevisableStatisticsAccumulator updates the moments like
+ * StatisticsAccumulator, and undoes the update exactly to remove() a value,
+ * so a corrected record costs O(1) instead of a rescan. The accessors match
+ * StatisticsAccumulator's.
+ *
+ * Use the accumulator with code like the following.
+
+ \code
+ #include <stats/RevisableStatisticsAccumulator.hpp>
+
+
+ stats::RevisableStatisticsAccumulator statistics;
+
+ statistics.add( 12.0 );
+ statistics.add( 99.0 ); // a bad reading
+
+ statistics.replace( 99.0, 13.0 ); // correct it
+
+ float u = statistics.mean(); // sets u to 12.5
+ \endcode
+
+ * The moments alone cannot recover the extremes after a removal, so by default
+ * a companion ordered count of the distinct values maintains the minimum
+ * and maximum, at O(log n) per update. Without it the updates are O(1), the
+ * minimum and maximum are undefined, and removals are not checked against
+ * the values added.
+ *
+ * Removal rounds differently from addition, so the moments of a long
+ * sequence of revisions drift slowly from those of a fresh accumulation.
+ */
+
+class RevisableStatisticsAccumulator
+{
+  private:
+    StatisticsAccumulator moments_;
+    bool track_extremes_;
+    std::map<float, std::size_t> values_;
+
+  public:
+    /**
+     * Makes an accumulator, with or without the companion maintaining the
+     * minimum and maximum.
+     */
+    explicit RevisableStatisticsAccumulator(bool track_extremes = true);
+
+    /**
+     * Updates the accumulated statistics with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Removes a value previously provided with add().
+     *
+     * Returns false, changing nothing, when there are no values, or when the
+     * extremes are tracked and the value is not among those added.
+     */
+    bool remove(const float& value);
+
+    /**
+     * Replaces a value previously provided with add() by the new value.
+     *
+     * Returns false, changing nothing, when the old value cannot be removed.
+     */
+    bool replace(const float& old_value, const float& new_value);
+
+    /**
+     * Returns true when the minimum and maximum are maintained.
+     */
+    bool tracks_extremes() const;
+
+    /**
+     * Returns the number of values currently accumulated.
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the minimum of the values, when the extremes are tracked.
+     */
+    float minimum() const;
+
+    /**
+     * Returns the maximum of the values, when the extremes are tracked.
+     */
+    float maximum() const;
+
+    /**
+     * Returns the arithmetic mean of the values.
+     */
+    float mean() const;
+
+    /**
+     * Returns the mean of the absolute values.
+     */
+    float absolute_mean() const;
+
+    /**
+     * Returns the quadratic mean (rms) of the values.
+     */
+    float quadratic_mean() const;
+
+    /**
+     * Returns the standard deviation of the values.
+     */
+    float standard_deviation() const;
+
+    /**
+     * Returns the skewness of the values.
+     */
+    float skewness() const;
+
+    /**
+     * Returns the excess kurtosis of the values.
+     */
+    float kurtosis() const;
+};
+
+} // namespace stats
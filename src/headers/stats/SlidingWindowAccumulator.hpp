@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Takes one value at a time, providing the statistics of the most recent
+ * values.
+ *
+ * SlidingWindowAccumulator keeps the last window_size() values in a ring.
+ * Each add() updates the moments with the new value and removes the value
+ * leaving the window by running the moment update in reverse. Two monotonic
+ * queues keep the window's exact minimum and maximum. Every add() costs
+ * O(1), amortized, whatever the window size.
+ *
+ * Use the accumulator with code like the following.
+
+ \code
+ #include <stats/SlidingWindowAccumulator.hpp>
+
+
+ stats::SlidingWindowAccumulator recent( 1000 );
+
+ recent.add( value );
+
+ float u = recent.mean(); // of the last 1000 values
+ \endcode
+
+ * Removal rounds differently from addition, so the moments are recomputed
+ * from the ring once per window_size() removals, bounding the drift. The
+ * accessors match StatisticsAccumulator's.
+ */
+
+class SlidingWindowAccumulator
+{
+  private:
+    std::size_t window_size_;
+    std::vector<float> ring_;
+    std::uint64_t added_;
+
+    StatisticsAccumulator moments_;
+    std::size_t removals_;
+
+    // positions of candidate extremes, oldest first, in rings of
+    // window_size() entries
+    std::vector<std::uint64_t> minima_, maxima_;
+    std::size_t minima_front_, minima_size_;
+    std::size_t maxima_front_, maxima_size_;
+
+    float value(const std::uint64_t& position) const;
+    void recompute();
+
+  public:
+    /**
+     * Makes an accumulator of the specified number of most recent values.
+     */
+    explicit SlidingWindowAccumulator(std::size_t window_size);
+
+    /**
+     * Updates the statistics with the value, dropping the oldest value once
+     * the window is full.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the statistics with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the maximum number of values in the window.
+     */
+    std::size_t window_size() const;
+
+    /**
+     * Returns the number of values in the window.
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the minimum of the values in the window.
+     */
+    float minimum() const;
+
+    /**
+     * Returns the maximum of the values in the window.
+     */
+    float maximum() const;
+
+    /**
+     * Returns the arithmetic mean of the values in the window.
+     */
+    float mean() const;
+
+    /**
+     * Returns the mean of the absolute values in the window.
+     */
+    float absolute_mean() const;
+
+    /**
+     * Returns the quadratic mean (rms) of the values in the window.
+     */
+    float quadratic_mean() const;
+
+    /**
+     * Returns the standard deviation of the values in the window.
+     */
+    float standard_deviation() const;
+
+    /**
+     * Returns the skewness of the values in the window.
+     */
+    float skewness() const;
+
+    /**
+     * Returns the excess kurtosis of the values in the window.
+     */
+    float kurtosis() const;
+
+    /**
+     * Returns the statistics of the values in the window, for combining with
+     * operator+(), or for description().
+     *
+     * The statistics are rebuilt from the ring, costing O(window_size()).
+     */
+    StatisticsAccumulator statistics() const;
+};
+
+} // namespace stats
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time, providing exact quantiles of only the most
+ * recent values.
+ *
+ * SlidingWindowQuantiles keeps the last window_size() values in an indexable
+ * skiplist: a sorted linked list with express lanes, each link recording how
+ * many values it skips. Adding a value, dropping the oldest, and finding the
+ * value at any rank all take O(log N) expected time, where N is the window
+ * size.
+ *
+ * Use the quantiles with a SlidingWindowAccumulator of the same size, for
+ * code like the following.
+
+ \code
+ #include <stats/SlidingWindowAccumulator.hpp>
+ #include <stats/SlidingWindowQuantiles.hpp>
+ #include <stats/StatisticsReport.hpp>
+
+
+ stats::SlidingWindowAccumulator recent( 1000 );
+ stats::SlidingWindowQuantiles recent_quantiles( 1000 );
+
+ recent.add( value );
+ recent_quantiles.add( value );
+
+ float median = recent_quantiles.median();
+ float p95    = recent_quantiles.quantile( 0.95 );
+
+ std::cout << stats::description( recent, recent_quantiles ) << std::endl;
+ \endcode
+
+ * Quantiles interpolate linearly between the values at the closest ranks,
+ * like ExactQuantiles. The nodes come from a pool sized for the window when
+ * the quantiles are made, so add() never allocates. Each pool node draws its
+ * height once, and a value takes the height of the node it is given, so the
+ * pool holds about two links per value.
+ *
+ * \sa
+ * <a href="https://code.activestate.com/recipes/576930/">
+ * Efficient running median using an indexable skiplist.
+ * </a>
+ * The skiplist follows Raymond Hettinger's recipe.
+ */
+
+class SlidingWindowQuantiles
+{
+  private:
+    std::size_t window_size_;
+    std::vector<float> ring_;
+    std::uint64_t added_;
+
+    // The node pool. Node 0 is the head and node 1 the end of the list. Each
+    // node's links sit together in next_ and widths_ from first_link_, and
+    // the link widths count the values skipped.
+    std::size_t levels_;
+    std::vector<std::uint32_t> keys_;
+    std::vector<std::uint8_t> heights_;
+    std::vector<std::size_t> first_link_;
+    std::vector<std::uint32_t> next_;
+    std::vector<std::uint32_t> widths_;
+    std::vector<std::uint32_t> free_nodes_;
+    std::uint32_t random_state_;
+
+    std::size_t link(const std::uint32_t& node, const std::size_t& level) const;
+    std::size_t random_height();
+    void insert(const std::uint32_t& key);
+    void erase(const std::uint32_t& key);
+    float value_at(std::size_t rank) const;
+
+  public:
+    /**
+     * Makes quantiles of the specified number of most recent values.
+     */
+    explicit SlidingWindowQuantiles(std::size_t window_size);
+
+    /**
+     * Updates the window with the value, dropping the oldest value once the
+     * window is full.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the window with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the maximum number of values in the window.
+     */
+    std::size_t window_size() const;
+
+    /**
+     * Returns the number of values currently in the window.
+     */
+    std::size_t count() const;
+
+    /**
+     * Returns the quantile of the values in the window with the specified
+     * probability.
+     *
+     * Returns the undefined-value marker when there are no values, or for a
+     * NaN probability.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * Returns the median of the values in the window.
+     */
+    float median() const;
+};
+
+} // namespace stats
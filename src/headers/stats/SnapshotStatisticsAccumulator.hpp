@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Accumulates statistics in one thread while other threads take consistent
+ * snapshots.
+ *
+ * SnapshotStatisticsAccumulator allows exactly one writer thread to call
+ * add(), and any number of reader threads to call snapshot(). The writer never
+ * waits for the readers. Each snapshot is a complete copy of the accumulated
+ * statistics at one moment, so its measures always agree with each other.
+ *
+ * Use the accumulator with code like the following.
+
+ \code
+ #include <stats/SnapshotStatisticsAccumulator.hpp>
+
+
+ stats::SnapshotStatisticsAccumulator shared;
+
+ // in the writer thread
+
+ shared.add( value );
+
+ // in a monitoring thread
+
+ stats::StatisticsAccumulator statistics = shared.snapshot();
+ size_t n = statistics.count();
+ float  k = statistics.kurtosis(); // always agrees with n
+ \endcode
+
+ * The accumulator publishes its state with a sequence lock. The writer bumps
+ * a sequence number to odd, copies the state, then bumps it to even. A reader
+ * retries its copy whenever the sequence number was odd or changed while it
+ * copied.
+ */
+
+class SnapshotStatisticsAccumulator
+{
+  private:
+    static constexpr std::size_t kWords =
+        (sizeof(StatisticsAccumulator) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    StatisticsAccumulator statistics_;
+    std::atomic<std::uint64_t> sequence_;
+    std::array<std::atomic<std::uint64_t>, kWords> published_;
+
+    void publish();
+
+  public:
+    SnapshotStatisticsAccumulator();
+
+    /**
+     * Updates the accumulated statistics with the value, and publishes them.
+     *
+     * Call add() from one thread only.
+     */
+    void add(const float& value);
+
+    /**
+     * Returns a consistent copy of the most recently published statistics.
+     *
+     * Call snapshot() from any thread.
+     */
+    StatisticsAccumulator snapshot() const;
+};
+
+} // namespace stats
@@ -72,6 +72,9 @@ class StatisticsAccumulator
     std::size_t count_;
     float minimum_, maximum_;
     double moment1_, abs_moment1_, moment2_, moment3_, moment4_;
+    bool extrema_known_;
+
+    static StatisticsAccumulator block(const float* values, std::size_t number_of_values);
 
   public:
     StatisticsAccumulator();
@@ -81,6 +84,25 @@ class StatisticsAccumulator
      */
     void add(const float& value);
 
+    /**
+     * Updates the accumulated statistics with an array of values.
+     *
+     * The values are processed in blocks. Each block's moments are computed
+     * in two passes over independent lanes, which the compiler vectorizes,
+     * and the block is then combined as with operator+=(). The results match
+     * one-at-a-time add() calls to within rounding.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Removes a value previously provided with add(), undoing its update.
+     *
+     * As after operator-(), the minimum and maximum become undefined.
+     * Removal rounds differently from addition, so the moments after many
+     * removals drift slowly from those of a fresh accumulation.
+     */
+    void remove(const float& value);
+
     /**
      * Returns the total number of values provided with add().
      */
@@ -88,11 +110,15 @@ class StatisticsAccumulator
 
     /**
      * Returns the minimum of the values provided with add().
+     *
+     * The minimum is undefined after remove() or operator-().
      */
     float minimum() const;
 
     /**
      * Returns the maximum of the values provided with add().
+     *
+     * The maximum is undefined after remove() or operator-().
      */
     float maximum() const;
 
@@ -162,6 +188,29 @@ class StatisticsAccumulator
      * "Adds" the specified accumulator to this one, aggregating the results.
      */
     StatisticsAccumulator& operator+=(const StatisticsAccumulator& rhs);
+
+    /**
+     * "Subtracts" accumulated statistics, removing values previously combined
+     * with operator+().
+     *
+     * Subtraction inverts the combination of the count and the moments, so
+     * the statistics of a range follow from two cumulative snapshots.
+
+     \code
+     StatisticsAccumulator between = cumulative_at_t2 - cumulative_at_t1;
+     \endcode
+
+     * The accumulator cannot tell which values were the extremes, so the
+     * minimum and maximum are undefined in the result, and in anything it is
+     * later combined with. Subtracting as many values as were accumulated,
+     * or more, gives an accumulator without values.
+     */
+    StatisticsAccumulator operator-(const StatisticsAccumulator& that) const;
+
+    /**
+     * "Subtracts" the specified accumulator from this one.
+     */
+    StatisticsAccumulator& operator-=(const StatisticsAccumulator& rhs);
 };
 
 } // namespace stats
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace stats
+{
+
+class StatisticsAccumulator;
+
+/**
+ * Queues values from many producer threads for accumulation in one consumer
+ * thread.
+ *
+ * StatisticsQueue is a bounded, lock-free, multi-producer/single-consumer
+ * ring buffer of 32-bit floating point values. Producers push() values, or
+ * small batches of values, without touching any accumulator. The consumer
+ * drain()s the queue in large blocks into a StatisticsAccumulator, using the
+ * accumulator's array add().
+ *
+ * Use the queue with code like the following.
+
+ \code
+ #include <stats/StatisticsAccumulator.hpp>
+ #include <stats/StatisticsQueue.hpp>
+
+
+ stats::StatisticsQueue queue( 65536 );
+
+ // in any producer thread
+
+ queue.push( value );
+
+ // in the consumer thread
+
+ stats::StatisticsAccumulator statistics;
+ queue.drain( statistics );
+ \endcode
+
+ * A full queue never blocks a producer. The values that do not fit are
+ * dropped, and counted in dropped().
+ *
+ * \sa
+ * <a href="https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue">
+ * Bounded MPMC queue.
+ * </a>
+ * The cells follow Dmitry Vyukov's sequence-numbered ring buffer.
+ */
+
+class StatisticsQueue
+{
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        float value;
+    };
+
+    std::vector<Cell> cells_;
+    std::size_t mask_;
+
+    alignas(64) std::atomic<std::size_t> enqueue_position_;
+    alignas(64) std::atomic<std::size_t> dequeue_position_;
+    alignas(64) std::atomic<std::uint64_t> dropped_;
+
+  public:
+    /**
+     * Makes a queue holding at least the specified number of values.
+     *
+     * The capacity is rounded up to a power of two.
+     */
+    explicit StatisticsQueue(std::size_t capacity);
+
+    /**
+     * Queues the value, returning false if the queue is full.
+     *
+     * Call push() from any thread.
+     */
+    bool push(const float& value);
+
+    /**
+     * Queues as many of the values as fit, returning the number queued.
+     *
+     * The batch claims its cells with one atomic operation. Call push() from
+     * any thread.
+     */
+    std::size_t push(const float* values, std::size_t number_of_values);
+
+    /**
+     * Moves all the available values in to the accumulator, returning the
+     * number of values moved.
+     *
+     * Call drain() from one consumer thread only.
+     */
+    std::size_t drain(StatisticsAccumulator& accumulator);
+
+    /**
+     * Returns the maximum number of values the queue holds.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Returns the approximate number of values waiting in the queue.
+     */
+    std::size_t depth() const;
+
+    /**
+     * Returns the total number of values that did not fit in the queue.
+     */
+    std::uint64_t dropped() const;
+};
+
+} // namespace stats
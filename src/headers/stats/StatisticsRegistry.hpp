@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Accumulates named statistics in thread-local accumulators, combining them
+ * on request and when threads exit.
+ *
+ * StatisticsRegistry gives each recording thread its own accumulator per
+ * metric, created on the thread's first record(). Recording takes no lock and
+ * touches no state shared with other recording threads. When a thread exits,
+ * its accumulators are combined in to the registry's retired totals.
+ * snapshot() returns the retired totals combined with the live thread-local
+ * accumulators.
+ *
+ * Use the registry with code like the following.
+
+ \code
+ #include <stats/StatisticsRegistry.hpp>
+
+
+ stats::StatisticsRegistry registry;
+ const std::size_t latency = registry.metric( "latency" );
+
+ // in any worker thread
+
+ registry.record( latency, value );
+
+ // in a reporting thread
+
+ stats::StatisticsAccumulator statistics = registry.snapshot( "latency" );
+ \endcode
+
+ * Look up a metric's id once with metric(), since metric() takes the
+ * registry lock. The thread-local accumulators publish their state like
+ * SnapshotStatisticsAccumulator, so snapshot() never blocks a recording
+ * thread.
+ */
+
+class StatisticsRegistry
+{
+  public:
+    struct State;
+
+  private:
+    std::shared_ptr<State> state_;
+
+  public:
+    StatisticsRegistry();
+    ~StatisticsRegistry();
+
+    StatisticsRegistry(const StatisticsRegistry&)            = delete;
+    StatisticsRegistry& operator=(const StatisticsRegistry&) = delete;
+
+    /**
+     * Returns the id of the named metric, creating the metric if necessary.
+     */
+    std::size_t metric(const std::string& name);
+
+    /**
+     * Updates the calling thread's accumulator for the metric with the value.
+     *
+     * Values for an id that metric() has not returned are ignored.
+     */
+    void record(std::size_t metric, const float& value);
+
+    /**
+     * Returns the combined statistics of the named metric from all threads.
+     */
+    StatisticsAccumulator snapshot(const std::string& name) const;
+
+    /**
+     * Returns the combined statistics of every metric from all threads.
+     */
+    std::map<std::string, StatisticsAccumulator> snapshot() const;
+};
+
+} // namespace stats
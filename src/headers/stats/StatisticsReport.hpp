@@ -5,7 +5,15 @@
 namespace stats
 {
 
+class DecayedHistogram;
+class ExponentialStatisticsAccumulator;
+class HistogramAccumulator;
+class LogLinearHistogram;
+class P2QuantileEstimator;
+class SlidingWindowAccumulator;
+class SlidingWindowQuantiles;
 class StatisticsAccumulator;
+class TDigest;
 
 /**
  * Returns a text description of the statistics, in a form suitable for
@@ -13,4 +21,49 @@ class StatisticsAccumulator;
  */
 std::string description(const stats::StatisticsAccumulator&);
 
+/**
+ * Returns a text description of the statistics, including the median from
+ * the quantile estimator when it is available.
+ */
+std::string description(const stats::StatisticsAccumulator&, const stats::P2QuantileEstimator&);
+
+/**
+ * Returns a text description of the statistics, including the median and the
+ * 90th, 99th and 99.9th percentiles from the digest.
+ */
+std::string description(const stats::StatisticsAccumulator&, const stats::TDigest&);
+
+/**
+ * Returns a text description of the statistics, including the median and the
+ * 90th, 99th and 99.9th percentiles from the histogram.
+ */
+std::string description(const stats::StatisticsAccumulator&, const stats::LogLinearHistogram&);
+
+/**
+ * Returns a text description of the statistics of a window of recent values,
+ * including the median and the 90th, 99th and 99.9th percentiles of the
+ * window.
+ */
+std::string description(const stats::SlidingWindowAccumulator&,
+                        const stats::SlidingWindowQuantiles&);
+
+/**
+ * Returns a text description of the exponentially weighted statistics, in the
+ * same form as for a StatisticsAccumulator.
+ */
+std::string description(const stats::ExponentialStatisticsAccumulator&);
+
+/**
+ * Returns a text description of the exponentially weighted statistics,
+ * including the decayed median and the 90th, 99th and 99.9th percentiles.
+ */
+std::string description(const stats::ExponentialStatisticsAccumulator&,
+                        const stats::DecayedHistogram&);
+
+/**
+ * Returns a text description of the histogram, with the count in each bin and
+ * any underflow and overflow counts.
+ */
+std::string description(const stats::HistogramAccumulator&);
+
 } // namespace stats
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Takes timestamped values or per-second statistics, providing the
+ * statistics of any time range from second, minute, hour and day roll-ups.
+ *
+ * StatisticsRollup keeps a StatisticsAccumulator node per second, ten
+ * seconds, minute, ten minutes, hour, six hours and day. As each second
+ * completes, its statistics are combined in to the coarser nodes containing
+ * it, so no level is ever rebuilt from the one below. Each level retains a
+ * bounded number of its newest nodes. Timestamps are in seconds, for example
+ * since the epoch.
+ *
+ * Use the roll-ups with code like the following.
+
+ \code
+ #include <stats/StatisticsRollup.hpp>
+
+
+ stats::StatisticsRollup rollup; // an hour of seconds, a day of minutes, ...
+
+ rollup.add( timestamp_s, value );
+ rollup.add( timestamp_s, statistics_for_that_second );
+
+ // the last hour, from at most 29 nodes, or one node when aligned
+
+ stats::StatisticsAccumulator statistics = rollup.range( now_s - 3600, now_s );
+ \endcode
+
+ * A range query splits the range greedily in to the widest aligned nodes
+ * that fit, so an aligned hour or day is one node. The in-between levels
+ * keep unaligned ranges short: any hour is at most 29 nodes, and any range
+ * at most 72 nodes plus one per whole day, instead of one per second. Parts
+ * of a range older than the retention of the levels fine enough to cover
+ * them are left out, and so are seconds not yet added.
+ *
+ * The ten second, ten minute and six hour levels span as much time as the
+ * second, minute and hour levels retain.
+ */
+
+class StatisticsRollup
+{
+  public:
+    /**
+     * The number of roll-up levels: seconds, ten seconds, minutes, ten
+     * minutes, hours, six hours and days.
+     */
+    static const std::size_t kLevels = 7;
+
+  private:
+    std::array<std::int64_t, kLevels> widths_;
+    std::array<std::int64_t, kLevels> retention_;
+    std::array<std::map<std::int64_t, StatisticsAccumulator>, kLevels> levels_;
+    std::array<std::int64_t, kLevels> newest_;
+
+    std::int64_t pending_second_;
+    StatisticsAccumulator pending_;
+
+    void roll_up(const std::int64_t& second, const StatisticsAccumulator& statistics);
+    bool retained(const std::size_t& level, const std::int64_t& node) const;
+    bool fits(const std::size_t& level, const std::int64_t& start, const std::int64_t& end) const;
+    void decompose(const std::int64_t& start, const std::int64_t& end,
+                   std::vector<const StatisticsAccumulator*>& nodes) const;
+
+  public:
+    /**
+     * Makes roll-ups retaining the specified numbers of the newest seconds,
+     * minutes, hours and days.
+     */
+    explicit StatisticsRollup(std::size_t seconds = 3600, std::size_t minutes = 1440,
+                              std::size_t hours = 720, std::size_t days = 366);
+
+    /**
+     * Updates the second containing the timestamp with the value.
+     *
+     * Values for the same second are gathered before the second is rolled up.
+     */
+    void add(const std::int64_t& timestamp, const float& value);
+
+    /**
+     * Updates the second containing the timestamp with the statistics.
+     */
+    void add(const std::int64_t& timestamp, const StatisticsAccumulator& statistics);
+
+    /**
+     * Returns the combined statistics of the seconds from start up to, but
+     * excluding, end.
+     */
+    StatisticsAccumulator range(const std::int64_t& start, const std::int64_t& end) const;
+
+    /**
+     * Returns the number of nodes range() combines for the same range, at
+     * most 72 plus one per whole day in the range.
+     */
+    std::size_t number_of_nodes(const std::int64_t& start, const std::int64_t& end) const;
+
+    /**
+     * Returns the width of the level's nodes, in seconds.
+     */
+    std::int64_t width(const std::size_t& level) const;
+
+    /**
+     * Returns the number of nodes the level currently holds.
+     */
+    std::size_t size(const std::size_t& level) const;
+};
+
+} // namespace stats
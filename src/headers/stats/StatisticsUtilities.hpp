@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace stats
 {
 
@@ -13,4 +15,10 @@ const float& undefined();
  */
 bool undefined(const float& value);
 
+/**
+ * Returns the number of threads to use when none is specified: the hardware
+ * concurrency, or 2 if it cannot be detected.
+ */
+std::size_t number_of_threads_hint();
+
 } // namespace stats
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace stats
+{
+
+/**
+ * Takes values one at a time or in arrays, providing mergeable estimates of
+ * quantiles.
+ *
+ * TDigest summarises the distribution of 32-bit floating point values with a
+ * bounded number of weighted centroids. The centroids are small near the
+ * tails, so extreme quantiles such as p99.9 stay accurate. Digests combine
+ * with operator+() like StatisticsAccumulator, so each thread or host can
+ * keep its own digest.
+ *
+ * add() buffers values and merges them in to the centroids when the buffer
+ * fills. The const methods merge any buffered values in a copy, so they only
+ * read the digest, and may run in several threads at once.
+ *
+ * Use the digest with code like the following.
+
+ \code
+ #include <stats/TDigest.hpp>
+
+
+ stats::TDigest latencies;
+
+ latencies.add( value );
+ latencies.add( values, number_of_values );
+
+ float p99 = latencies.quantile( 0.99 );
+
+ // combine, or ship to another host
+
+ stats::TDigest combined = digest1 + digest2;
+ std::string bytes = combined.serialize();
+ \endcode
+
+ * \sa
+ * <a href="https://arxiv.org/abs/1902.04023">
+ * Computing Extremely Accurate Quantiles Using t-Digests.
+ * </a>
+ * This class is Ted Dunning and Otmar Ertl's merging digest, with the k1
+ * (arcsine) scale function.
+ */
+
+class TDigest
+{
+  private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    double compression_;
+    std::vector<Centroid> centroids_;
+    std::vector<Centroid> buffer_;
+    std::uint64_t count_;
+    float minimum_, maximum_;
+
+    std::vector<Centroid> merged() const;
+    void compress();
+
+  public:
+    /**
+     * Makes a digest with the specified compression.
+     *
+     * Higher compression gives more accurate quantiles, with about
+     * compression / 2 centroids. The compression is clamped to between 10
+     * and 100000, and a NaN compression gives 10.
+     */
+    explicit TDigest(double compression = 100.0);
+
+    /**
+     * Updates the digest with the value.
+     */
+    void add(const float& value);
+
+    /**
+     * Updates the digest with an array of values.
+     */
+    void add(const float* values, std::size_t number_of_values);
+
+    /**
+     * Returns the total number of values provided with add().
+     */
+    std::uint64_t count() const;
+
+    /**
+     * Returns the number of centroids summarising the values.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns the estimate of the quantile with the specified probability.
+     *
+     * Returns the undefined-value marker when no values were added.
+     */
+    float quantile(const double& probability) const;
+
+    /**
+     * "Adds" digests, aggregating the results.
+     *
+     * The result has the larger of the two compressions.
+     */
+    TDigest operator+(const TDigest& that) const;
+
+    /**
+     * "Adds" the specified digest to this one, aggregating the results.
+     */
+    TDigest& operator+=(const TDigest& rhs);
+
+    /**
+     * Returns a compact binary form of the digest, in host byte order.
+     */
+    std::string serialize() const;
+
+    /**
+     * Replaces the digest with one from serialize(), returning false and
+     * leaving the digest unchanged if the bytes are not a valid digest.
+     */
+    bool deserialize(const std::string& bytes);
+};
+
+} // namespace stats
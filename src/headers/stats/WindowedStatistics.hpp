@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+/**
+ * Takes timestamped values, arriving roughly in time order, providing the
+ * statistics of fixed-width time buckets and of windows of buckets.
+ *
+ * WindowedStatistics keeps a ring of StatisticsAccumulator buckets, each
+ * covering bucket_width() ticks. A window of several buckets, tumbling or
+ * hopping, is the operator+() combination of its buckets. Timestamps are in
+ * any integer unit, such as milliseconds.
+ *
+ * Use the windows with code like the following.
+
+ \code
+ #include <stats/WindowedStatistics.hpp>
+
+
+ // 1 second buckets over 2 minutes, accepting events up to 500 ms late
+
+ stats::WindowedStatistics windows( 1000, 120, 500 );
+
+ windows.add( timestamp_ms, value );
+
+ // the 10 second window hopping every second, once it is complete
+
+ if( windows.sealed( start_ms + 10000 ) ){
+     stats::StatisticsAccumulator statistics = windows.window( start_ms, start_ms + 10000 );
+ }
+ \endcode
+
+ * The watermark trails the latest timestamp by the allowed lateness. A
+ * bucket ending at or before the watermark is sealed: its statistics are
+ * final, and later values for it are dropped and counted in late(). The
+ * ring reuses its buckets in place, so add() never allocates.
+ */
+
+class WindowedStatistics
+{
+  private:
+    std::int64_t bucket_width_;
+    std::int64_t allowed_lateness_;
+    std::vector<StatisticsAccumulator> buckets_;
+    std::vector<std::int64_t> bucket_numbers_;
+    std::int64_t latest_timestamp_;
+    std::int64_t newest_bucket_;
+    std::uint64_t late_;
+    bool empty_;
+
+    std::int64_t bucket_number(const std::int64_t& timestamp) const;
+    std::size_t slot(const std::int64_t& bucket_number) const;
+    std::int64_t oldest_bucket() const;
+    bool retained(const std::int64_t& bucket_number) const;
+
+  public:
+    /**
+     * Makes a ring of the specified number of buckets, each bucket_width
+     * ticks wide, accepting values up to allowed_lateness ticks behind the
+     * latest timestamp.
+     */
+    WindowedStatistics(std::int64_t bucket_width, std::size_t number_of_buckets,
+                       std::int64_t allowed_lateness = 0);
+
+    /**
+     * Updates the bucket containing the timestamp with the value.
+     *
+     * Returns false, and counts the value in late(), when the bucket is
+     * already sealed or no longer in the ring.
+     */
+    bool add(const std::int64_t& timestamp, const float& value);
+
+    /**
+     * Returns the width of each bucket, in ticks.
+     */
+    std::int64_t bucket_width() const;
+
+    /**
+     * Returns the watermark: the latest timestamp less the allowed lateness,
+     * or the lowest timestamp if that is lower.
+     *
+     * Returns the lowest timestamp before any values.
+     */
+    std::int64_t watermark() const;
+
+    /**
+     * Returns true when every bucket before the timestamp is sealed.
+     */
+    bool sealed(const std::int64_t& timestamp) const;
+
+    /**
+     * Returns the number of values dropped for arriving too late.
+     */
+    std::uint64_t late() const;
+
+    /**
+     * Returns the statistics of the bucket containing the timestamp.
+     *
+     * The statistics are empty for buckets no longer in the ring.
+     */
+    StatisticsAccumulator bucket(const std::int64_t& timestamp) const;
+
+    /**
+     * Returns the combined statistics of the buckets from the one containing
+     * start up to, but excluding, the one containing end.
+     */
+    StatisticsAccumulator window(const std::int64_t& start, const std::int64_t& end) const;
+};
+
+} // namespace stats
@@ -0,0 +1,79 @@
+#include "stats/BufferedStatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+BufferedStatisticsAccumulator::BufferedStatisticsAccumulator()
+    : buffer_()
+    , buffered_(0)
+{
+}
+
+void BufferedStatisticsAccumulator::add(const float& value)
+{
+    buffer_[buffered_++] = value;
+    if (buffered_ == kBufferSize)
+    {
+        flush();
+    }
+}
+
+void BufferedStatisticsAccumulator::flush()
+{
+    statistics_.add(buffer_.data(), buffered_);
+    buffered_ = 0;
+}
+
+StatisticsAccumulator BufferedStatisticsAccumulator::statistics() const
+{
+    StatisticsAccumulator statistics = statistics_;
+    statistics.add(buffer_.data(), buffered_);
+    return statistics;
+}
+
+std::size_t BufferedStatisticsAccumulator::count() const
+{
+    return statistics_.count() + buffered_;
+}
+
+float BufferedStatisticsAccumulator::minimum() const
+{
+    return statistics().minimum();
+}
+
+float BufferedStatisticsAccumulator::maximum() const
+{
+    return statistics().maximum();
+}
+
+float BufferedStatisticsAccumulator::mean() const
+{
+    return statistics().mean();
+}
+
+float BufferedStatisticsAccumulator::absolute_mean() const
+{
+    return statistics().absolute_mean();
+}
+
+float BufferedStatisticsAccumulator::quadratic_mean() const
+{
+    return statistics().quadratic_mean();
+}
+
+float BufferedStatisticsAccumulator::standard_deviation() const
+{
+    return statistics().standard_deviation();
+}
+
+float BufferedStatisticsAccumulator::skewness() const
+{
+    return statistics().skewness();
+}
+
+float BufferedStatisticsAccumulator::kurtosis() const
+{
+    return statistics().kurtosis();
+}
+
+} // namespace stats
@@ -0,0 +1,315 @@
+#include "stats/DDSketch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values per index computation in the array add().
+const std::size_t kIndexBlockSize = 256;
+
+// Magnitudes below this count as zero.
+const float kMinimumIndexable = std::numeric_limits<float>::min();
+
+} // unnamed namespace
+
+namespace stats
+{
+
+DDSketch::Store::Store()
+    : offset_(0)
+{
+}
+
+void DDSketch::Store::add(std::int32_t index, const std::uint64_t& count,
+                          const std::size_t& max_bins)
+{
+    if (counts_.empty())
+    {
+        counts_.assign(1, 0);
+        offset_ = index;
+    }
+
+    // Keep at most max_bins buckets, ending at the highest index. Buckets
+    // below the lowest one kept, including the new index, collapse in to it
+    // before the vector grows, so it never holds more than max_bins.
+    const std::int64_t highest = offset_ + static_cast<std::int64_t>(counts_.size()) - 1;
+    const std::int64_t new_highest = std::max<std::int64_t>(highest, index);
+    const std::int64_t new_lowest =
+        std::max<std::int64_t>(std::min<std::int64_t>(offset_, index),
+                               new_highest - static_cast<std::int64_t>(max_bins) + 1);
+
+    if (new_lowest != offset_)
+    {
+        std::vector<std::uint64_t> counts(static_cast<std::size_t>(new_highest - new_lowest) + 1,
+                                          0);
+        for (std::size_t i = 0; i < counts_.size(); ++i)
+        {
+            const std::int64_t old_index = offset_ + static_cast<std::int64_t>(i);
+            counts[static_cast<std::size_t>(std::max(old_index, new_lowest) - new_lowest)] +=
+                counts_[i];
+        }
+        counts_.swap(counts);
+        offset_ = static_cast<std::int32_t>(new_lowest);
+    }
+    else if (new_highest > highest)
+    {
+        counts_.resize(static_cast<std::size_t>(new_highest - offset_) + 1, 0);
+    }
+
+    counts_[static_cast<std::size_t>(std::max(index, offset_) - offset_)] += count;
+}
+
+bool DDSketch::Store::empty() const
+{
+    return counts_.empty();
+}
+
+std::size_t DDSketch::Store::size() const
+{
+    return counts_.size();
+}
+
+std::int32_t DDSketch::Store::lowest_index() const
+{
+    return offset_;
+}
+
+std::uint64_t DDSketch::Store::count(const std::int32_t& index) const
+{
+    return counts_[static_cast<std::size_t>(index - offset_)];
+}
+
+DDSketch::DDSketch(double relative_accuracy, std::size_t max_bins)
+    : relative_accuracy_(std::min(std::max(relative_accuracy, 1.0e-6), 0.5))
+    , gamma_((1.0 + relative_accuracy_) / (1.0 - relative_accuracy_))
+    , log_gamma_(log(gamma_))
+    , max_bins_(std::max<std::size_t>(max_bins, 1))
+    , zero_count_(0)
+    , negative_infinities_(0)
+    , positive_infinities_(0)
+    , count_(0)
+    , minimum_(std::numeric_limits<float>::max())
+    , maximum_(-std::numeric_limits<float>::max())
+{
+}
+
+std::int32_t DDSketch::index(const float& magnitude) const
+{
+    return static_cast<std::int32_t>(ceil(log(static_cast<double>(magnitude)) / log_gamma_));
+}
+
+float DDSketch::value(const std::int32_t& index) const
+{
+    // the point within relative accuracy of both bucket boundaries
+    return static_cast<float>(2.0 * pow(gamma_, index) / (gamma_ + 1.0));
+}
+
+void DDSketch::add(const float& value)
+{
+    add(value, 1);
+}
+
+void DDSketch::add(const float& value, const std::uint64_t& count)
+{
+    if (value == std::numeric_limits<float>::infinity())
+    {
+        positive_infinities_ += count;
+    }
+    else if (value == -std::numeric_limits<float>::infinity())
+    {
+        negative_infinities_ += count;
+    }
+    else if (value > kMinimumIndexable)
+    {
+        positive_.add(index(value), count, max_bins_);
+    }
+    else if (value < -kMinimumIndexable)
+    {
+        negative_.add(index(-value), count, max_bins_);
+    }
+    else
+    {
+        zero_count_ += count;
+    }
+    count_ += count;
+    minimum_ = std::min(minimum_, value); // NaN keeps the extremes
+    maximum_ = std::max(maximum_, value);
+}
+
+void DDSketch::add(const float* values, std::size_t number_of_values)
+{
+    // Compute the bucket indexes of a block of magnitudes in one loop, then
+    // count them in another.
+    std::array<std::int32_t, kIndexBlockSize> indexes;
+    for (std::size_t first = 0; first < number_of_values; first += kIndexBlockSize)
+    {
+        const std::size_t block_size = std::min(kIndexBlockSize, number_of_values - first);
+        const float* block           = values + first;
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            // infinity and NaN take finite magnitudes, and are counted apart
+            indexes[i] = index(std::min(std::max(kMinimumIndexable, std::fabs(block[i])),
+                                        std::numeric_limits<float>::max()));
+        }
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            if (block[i] == std::numeric_limits<float>::infinity())
+            {
+                ++positive_infinities_;
+            }
+            else if (block[i] == -std::numeric_limits<float>::infinity())
+            {
+                ++negative_infinities_;
+            }
+            else if (block[i] > kMinimumIndexable)
+            {
+                positive_.add(indexes[i], 1, max_bins_);
+            }
+            else if (block[i] < -kMinimumIndexable)
+            {
+                negative_.add(indexes[i], 1, max_bins_);
+            }
+            else
+            {
+                ++zero_count_;
+            }
+            minimum_ = std::min(minimum_, block[i]);
+            maximum_ = std::max(maximum_, block[i]);
+        }
+    }
+    count_ += number_of_values;
+}
+
+std::uint64_t DDSketch::count() const
+{
+    return count_;
+}
+
+std::size_t DDSketch::size() const
+{
+    return positive_.size() + negative_.size() + (zero_count_ > 0 ? 1 : 0) +
+           (negative_infinities_ > 0 ? 1 : 0) + (positive_infinities_ > 0 ? 1 : 0);
+}
+
+double DDSketch::relative_accuracy() const
+{
+    return relative_accuracy_;
+}
+
+float DDSketch::quantile(const double& probability) const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+    if (probability <= 0.0)
+    {
+        return minimum_;
+    }
+    if (probability >= 1.0)
+    {
+        return maximum_;
+    }
+
+    const double rank = probability * static_cast<double>(count_ - 1);
+    std::uint64_t cumulative = negative_infinities_;
+    if (static_cast<double>(cumulative) > rank)
+    {
+        return -std::numeric_limits<float>::infinity();
+    }
+
+    // negative values, from the largest magnitude down
+    if (!negative_.empty())
+    {
+        const std::int32_t lowest = negative_.lowest_index();
+        for (std::int32_t index = lowest + static_cast<std::int32_t>(negative_.size()) - 1;
+             index >= lowest; --index)
+        {
+            cumulative += negative_.count(index);
+            if (static_cast<double>(cumulative) > rank)
+            {
+                return std::max(-value(index), minimum_);
+            }
+        }
+    }
+
+    cumulative += zero_count_;
+    if (static_cast<double>(cumulative) > rank)
+    {
+        return 0.F;
+    }
+
+    // positive values, from the smallest up
+    const std::int32_t lowest = positive_.lowest_index();
+    for (std::int32_t index = lowest; index < lowest + static_cast<std::int32_t>(positive_.size());
+         ++index)
+    {
+        cumulative += positive_.count(index);
+        if (static_cast<double>(cumulative) > rank)
+        {
+            return std::min(value(index), maximum_);
+        }
+    }
+    return maximum_; // or a positive infinity
+}
+
+DDSketch DDSketch::operator+(const DDSketch& that) const
+{
+    DDSketch combined = *this;
+    if (that.count_ == 0)
+    {
+        return combined;
+    }
+
+    const bool same_buckets = this->gamma_ == that.gamma_;
+    for (const int sign : {+1, -1})
+    {
+        const Store& store = sign > 0 ? that.positive_ : that.negative_;
+        if (store.empty())
+        {
+            continue;
+        }
+        for (std::int32_t index = store.lowest_index();
+             index < store.lowest_index() + static_cast<std::int32_t>(store.size()); ++index)
+        {
+            const std::uint64_t count = store.count(index);
+            if (count == 0)
+            {
+                continue;
+            }
+            if (same_buckets)
+            {
+                (sign > 0 ? combined.positive_ : combined.negative_)
+                    .add(index, count, combined.max_bins_);
+                combined.count_ += count;
+            }
+            else
+            {
+                combined.add(static_cast<float>(sign) * that.value(index), count);
+            }
+        }
+    }
+    combined.zero_count_ += that.zero_count_;
+    combined.negative_infinities_ += that.negative_infinities_;
+    combined.positive_infinities_ += that.positive_infinities_;
+    combined.count_ += that.zero_count_ + that.negative_infinities_ + that.positive_infinities_;
+
+    combined.minimum_ = std::min(this->minimum_, that.minimum_);
+    combined.maximum_ = std::max(this->maximum_, that.maximum_);
+    return combined;
+}
+
+DDSketch& DDSketch::operator+=(const DDSketch& rhs)
+{
+    DDSketch combined = *this + rhs;
+    *this             = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,228 @@
+#include "stats/DecayedHistogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "LogLinearBuckets.hpp"
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values per bucket-index computation in the array record().
+const std::size_t kIndexBlockSize = 256;
+
+// Half-lives past the landmark at which it moves. Weights up to 2^512 leave
+// plenty of double range for their sums.
+const double kLandmarkHalfLives = 512.0;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+DecayedHistogram::DecayedHistogram(double half_life, float lowest, float highest,
+                                   unsigned precision_bits)
+    : half_life_(half_life > 0.0 ? half_life : 1.0)
+    , precision_bits_(std::min(std::max(precision_bits, 1U), 23U))
+    , lowest_key_(detail::log_linear_key(std::max(lowest, std::numeric_limits<float>::min()),
+                                         precision_bits_))
+    , highest_key_(std::max(detail::log_linear_key(highest, precision_bits_), lowest_key_))
+    , weights_(static_cast<std::size_t>(highest_key_ - lowest_key_) + 1, 0.0)
+    , landmark_(0.0)
+    , latest_(0.0)
+    , total_(0.0)
+    , count_(0)
+    , minimum_(std::numeric_limits<float>::max())
+    , maximum_(-std::numeric_limits<float>::max())
+{
+}
+
+void DecayedHistogram::move_landmark(const double& landmark)
+{
+    const double scale = exp2((landmark_ - landmark) / half_life_);
+    for (double& weight : weights_)
+    {
+        weight *= scale;
+    }
+    total_ *= scale;
+    landmark_ = landmark;
+}
+
+double DecayedHistogram::forward_weight(const double& timestamp)
+{
+    if (count_ == 0)
+    {
+        landmark_ = timestamp;
+        latest_   = timestamp;
+    }
+    else if (timestamp > latest_)
+    {
+        latest_ = timestamp;
+    }
+
+    if ((latest_ - landmark_) / half_life_ > kLandmarkHalfLives)
+    {
+        move_landmark(latest_);
+    }
+
+    return exp2((timestamp - landmark_) / half_life_);
+}
+
+void DecayedHistogram::record(const float& value, const double& weight)
+{
+    std::uint32_t index = 0;
+    detail::log_linear_indexes(&value, 1, precision_bits_, lowest_key_, highest_key_, &index);
+    weights_[index] += weight;
+    total_ += weight;
+    minimum_ = std::min(value, minimum_);
+    maximum_ = std::max(value, maximum_);
+}
+
+void DecayedHistogram::record(const double& timestamp, const float& value)
+{
+    const double weight = forward_weight(timestamp);
+    record(value, weight);
+    ++count_;
+}
+
+void DecayedHistogram::record(const double& timestamp, const float* values,
+                              std::size_t number_of_values)
+{
+    if (number_of_values == 0)
+    {
+        return;
+    }
+
+    // one weight for the whole array
+    const double weight = forward_weight(timestamp);
+
+    std::array<std::uint32_t, kIndexBlockSize> indexes;
+    for (std::size_t first = 0; first < number_of_values; first += kIndexBlockSize)
+    {
+        const std::size_t block_size = std::min(kIndexBlockSize, number_of_values - first);
+        detail::log_linear_indexes(values + first, block_size, precision_bits_, lowest_key_,
+                                   highest_key_, indexes.data());
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            weights_[indexes[i]] += weight;
+            minimum_ = std::min(values[first + i], minimum_);
+            maximum_ = std::max(values[first + i], maximum_);
+        }
+    }
+    total_ += weight * static_cast<double>(number_of_values);
+    count_ += number_of_values;
+}
+
+double DecayedHistogram::half_life() const
+{
+    return half_life_;
+}
+
+double DecayedHistogram::time() const
+{
+    return latest_;
+}
+
+double DecayedHistogram::landmark() const
+{
+    return landmark_;
+}
+
+double DecayedHistogram::weight() const
+{
+    return total_ * exp2((landmark_ - latest_) / half_life_);
+}
+
+std::uint64_t DecayedHistogram::count() const
+{
+    return count_;
+}
+
+std::size_t DecayedHistogram::size() const
+{
+    return weights_.size();
+}
+
+float DecayedHistogram::quantile(const double& probability) const
+{
+    if (count_ == 0 || total_ <= 0.0)
+    {
+        return stats::undefined();
+    }
+
+    // the first bucket with weight reaching the rank, skipping empty buckets
+    const double rank = std::min(std::max(probability, 0.0), 1.0) * total_;
+
+    double cumulative = 0.0;
+    std::size_t index = 0;
+    while (index + 1 < weights_.size() &&
+           (weights_[index] == 0.0 || cumulative + weights_[index] < rank))
+    {
+        cumulative += weights_[index];
+        ++index;
+    }
+
+    const std::int32_t key = lowest_key_ + static_cast<std::int32_t>(index);
+    const float middle     = detail::log_linear_midpoint(key, precision_bits_);
+    return std::min(std::max(middle, minimum_), maximum_);
+}
+
+DecayedHistogram DecayedHistogram::operator+(const DecayedHistogram& that) const
+{
+    if (that.count_ == 0)
+    {
+        return *this;
+    }
+
+    DecayedHistogram combined = *this;
+    if (combined.count_ == 0)
+    {
+        combined.landmark_ = that.landmark_;
+        combined.latest_   = that.latest_;
+    }
+
+    // measure both from the later landmark
+    const double landmark = std::max(combined.landmark_, that.landmark_);
+    combined.move_landmark(landmark);
+    const double scale = exp2((that.landmark_ - landmark) / half_life_);
+
+    if (this->precision_bits_ == that.precision_bits_ &&
+        this->lowest_key_ == that.lowest_key_ && this->highest_key_ == that.highest_key_)
+    {
+        for (std::size_t index = 0; index < weights_.size(); ++index)
+        {
+            combined.weights_[index] += scale * that.weights_[index];
+        }
+        combined.total_ += scale * that.total_;
+    }
+    else
+    {
+        for (std::size_t index = 0; index < that.weights_.size(); ++index)
+        {
+            if (that.weights_[index] > 0.0)
+            {
+                const std::int32_t key = that.lowest_key_ + static_cast<std::int32_t>(index);
+                combined.record(detail::log_linear_midpoint(key, that.precision_bits_),
+                                scale * that.weights_[index]);
+            }
+        }
+    }
+
+    combined.count_ += that.count_;
+    combined.latest_  = std::max(combined.latest_, that.latest_);
+    combined.minimum_ = std::min(combined.minimum_, that.minimum_);
+    combined.maximum_ = std::max(combined.maximum_, that.maximum_);
+    return combined;
+}
+
+DecayedHistogram& DecayedHistogram::operator+=(const DecayedHistogram& rhs)
+{
+    DecayedHistogram combined = *this + rhs;
+    *this                     = combined;
+    return *this;
+}
+
+} // namespace stats
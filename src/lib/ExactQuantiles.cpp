@@ -0,0 +1,255 @@
+#include "stats/ExactQuantiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "OrderedFloatKeys.hpp"
+#include "ParallelBlocks.hpp"
+#include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Each pass counts one 16-bit digit of the keys.
+const std::size_t kDigits = std::size_t(1) << 16;
+
+// Buckets resolved per second pass. More buckets take more passes.
+const std::size_t kMaximumSlots = 4;
+const std::uint8_t kNoSlot      = 0xff;
+
+// Values per block of the first pass, counted then added to the statistics
+// while still in the cache.
+const std::size_t kBlockSize = 1024;
+
+// Fewer values than this per thread are not worth a thread.
+const std::size_t kMinimumValuesPerThread = std::size_t(1) << 16;
+
+// A rank to find, and where it was found.
+struct Target
+{
+    std::uint64_t rank;
+    std::uint64_t rank_in_bucket;
+    std::uint32_t bucket;
+    std::uint32_t key;
+};
+
+} // unnamed namespace
+
+namespace stats
+{
+
+ExactQuantiles::ExactQuantiles(std::size_t number_of_threads)
+    : number_of_threads_(number_of_threads == 0 ? stats::number_of_threads_hint()
+                                                : number_of_threads)
+{
+}
+
+std::vector<float> ExactQuantiles::quantiles(const float* values, std::size_t number_of_values,
+                                             const std::vector<double>& probabilities)
+{
+    return select(values, number_of_values, probabilities, nullptr);
+}
+
+std::vector<float> ExactQuantiles::quantiles(const float* values, std::size_t number_of_values,
+                                             const std::vector<double>& probabilities,
+                                             StatisticsAccumulator& statistics)
+{
+    return select(values, number_of_values, probabilities, &statistics);
+}
+
+std::vector<float> ExactQuantiles::select(const float* values, std::size_t number_of_values,
+                                          const std::vector<double>& probabilities,
+                                          StatisticsAccumulator* statistics)
+{
+    std::vector<float> quantiles(probabilities.size(), stats::undefined());
+    if (number_of_values == 0)
+    {
+        return quantiles;
+    }
+
+    const std::size_t number_of_threads = std::max<std::size_t>(
+        1, std::min(number_of_threads_, number_of_values / kMinimumValuesPerThread));
+    histograms_.resize(number_of_threads * kMaximumSlots * kDigits);
+    slots_.resize(kDigits);
+
+    // the ranks either side of each probability's position
+
+    std::vector<Target> targets;
+    for (const double& probability : probabilities)
+    {
+        if (std::isnan(probability))
+        {
+            continue; // its quantile stays undefined
+        }
+        const double position =
+            std::min(std::max(probability, 0.0), 1.0) * static_cast<double>(number_of_values - 1);
+        const std::uint64_t below = static_cast<std::uint64_t>(position);
+        targets.push_back({below, 0, 0, 0});
+        targets.push_back({std::min<std::uint64_t>(below + 1, number_of_values - 1), 0, 0, 0});
+    }
+    std::sort(targets.begin(), targets.end(),
+              [](const Target& a, const Target& b) { return a.rank < b.rank; });
+
+    // first pass: count the high digits, and locate the target buckets
+
+    const std::size_t number_of_accumulators = statistics != nullptr ? number_of_threads : 0;
+    std::vector<StatisticsAccumulator> thread_statistics(number_of_accumulators);
+    detail::run_in_blocks(
+        number_of_values, number_of_threads,
+        [&](std::size_t thread, std::size_t begin, std::size_t end)
+        {
+            std::uint64_t* histogram = histograms_.data() + thread * kDigits;
+            std::fill(histogram, histogram + kDigits, 0);
+            for (std::size_t first = begin; first < end; first += kBlockSize)
+            {
+                const std::size_t block_end = std::min(first + kBlockSize, end);
+                for (std::size_t i = first; i < block_end; ++i)
+                {
+                    ++histogram[detail::ordered_key(values[i]) >> 16];
+                }
+                if (statistics != nullptr)
+                {
+                    thread_statistics[thread].add(values + first, block_end - first);
+                }
+            }
+        });
+
+    for (const StatisticsAccumulator& block_statistics : thread_statistics)
+    {
+        *statistics += block_statistics;
+    }
+
+    std::uint64_t* histogram = histograms_.data();
+    for (std::size_t thread = 1; thread < number_of_threads; ++thread)
+    {
+        const std::uint64_t* other = histograms_.data() + thread * kDigits;
+        for (std::size_t digit = 0; digit < kDigits; ++digit)
+        {
+            histogram[digit] += other[digit];
+        }
+    }
+
+    std::uint64_t below_bucket = 0;
+    std::uint32_t bucket       = 0;
+    for (Target& target : targets)
+    {
+        while (below_bucket + histogram[bucket] <= target.rank)
+        {
+            below_bucket += histogram[bucket];
+            ++bucket;
+        }
+        target.bucket         = bucket;
+        target.rank_in_bucket = target.rank - below_bucket;
+    }
+
+    // second passes: count the low digits in up to kMaximumSlots buckets
+
+    for (std::size_t first = 0; first < targets.size();)
+    {
+        std::fill(slots_.begin(), slots_.end(), kNoSlot);
+        std::vector<std::uint32_t> buckets;
+        std::size_t last = first;
+        for (; last < targets.size(); ++last)
+        {
+            if (buckets.empty() || buckets.back() != targets[last].bucket)
+            {
+                if (buckets.size() == kMaximumSlots)
+                {
+                    break;
+                }
+                slots_[targets[last].bucket] = static_cast<std::uint8_t>(buckets.size());
+                buckets.push_back(targets[last].bucket);
+            }
+        }
+        const std::size_t number_of_slots = buckets.size();
+
+        detail::run_in_blocks(
+            number_of_values, number_of_threads,
+            [&](std::size_t thread, std::size_t begin, std::size_t end)
+            {
+                std::uint64_t* histograms =
+                    histograms_.data() + thread * kMaximumSlots * kDigits;
+                std::fill(histograms, histograms + number_of_slots * kDigits, 0);
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::uint32_t k   = detail::ordered_key(values[i]);
+                    const std::uint8_t slot = slots_[k >> 16];
+                    if (slot != kNoSlot)
+                    {
+                        ++histograms[slot * kDigits + (k & 0xffffU)];
+                    }
+                }
+            });
+
+        std::uint64_t* histograms = histograms_.data();
+        for (std::size_t thread = 1; thread < number_of_threads; ++thread)
+        {
+            const std::uint64_t* other = histograms_.data() + thread * kMaximumSlots * kDigits;
+            for (std::size_t i = 0; i < number_of_slots * kDigits; ++i)
+            {
+                histograms[i] += other[i];
+            }
+        }
+
+        for (std::size_t t = first; t < last; ++t)
+        {
+            const std::uint64_t* low = histograms + slots_[targets[t].bucket] * kDigits;
+            std::uint64_t below      = 0;
+            std::uint32_t digit      = 0;
+            while (below + low[digit] <= targets[t].rank_in_bucket)
+            {
+                below += low[digit];
+                ++digit;
+            }
+            targets[t].key = (targets[t].bucket << 16) | digit;
+        }
+        first = last;
+    }
+
+    // interpolate between the closest ranks
+
+    auto value_at = [&](const std::uint64_t& rank)
+    {
+        const auto found = std::lower_bound(targets.begin(), targets.end(), rank,
+                                            [](const Target& target, const std::uint64_t& wanted)
+                                            { return target.rank < wanted; });
+        return detail::ordered_value(found->key);
+    };
+
+    for (std::size_t i = 0; i < probabilities.size(); ++i)
+    {
+        if (std::isnan(probabilities[i]))
+        {
+            continue;
+        }
+        const double position = std::min(std::max(probabilities[i], 0.0), 1.0) *
+                                static_cast<double>(number_of_values - 1);
+        const std::uint64_t below = static_cast<std::uint64_t>(position);
+        const double fraction     = position - static_cast<double>(below);
+
+        const double lower = value_at(below);
+        if (fraction == 0.0)
+        {
+            quantiles[i] = static_cast<float>(lower);
+            continue;
+        }
+        const double upper = value_at(below + 1);
+        quantiles[i]       = static_cast<float>(lower + fraction * (upper - lower));
+    }
+
+    return quantiles;
+}
+
+float ExactQuantiles::quantile(const float* values, std::size_t number_of_values,
+                               const double& probability)
+{
+    return quantiles(values, number_of_values, {probability}).front();
+}
+
+float ExactQuantiles::median(const float* values, std::size_t number_of_values)
+{
+    return quantile(values, number_of_values, 0.5);
+}
+
+} // namespace stats
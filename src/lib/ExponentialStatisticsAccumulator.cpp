@@ -0,0 +1,339 @@
+#include "stats/ExponentialStatisticsAccumulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values per block in the bulk update, as in StatisticsAccumulator.
+const std::size_t kBlockSize = 1024;
+
+// Independent partial sums per pass, letting the compiler vectorize the loops.
+const std::size_t kLanes = 8;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+ExponentialStatisticsAccumulator::ExponentialStatisticsAccumulator(double half_life)
+    : half_life_(half_life > 0.0 ? half_life : 1.0)
+    , decay_per_tick_(exp2(-1.0 / half_life_))
+    , time_(0.0)
+    , count_(0)
+    , minimum_(std::numeric_limits<float>::max())
+    , maximum_(-std::numeric_limits<float>::max())
+    , moments_({0.0, 0.0, 0.0, 0.0, 0.0, 0.0})
+{
+}
+
+void ExponentialStatisticsAccumulator::decay(const double& factor)
+{
+    // scaling every weight leaves the means, and scales the sums
+    moments_.weight *= factor;
+    moments_.moment2 *= factor;
+    moments_.moment3 *= factor;
+    moments_.moment4 *= factor;
+}
+
+void ExponentialStatisticsAccumulator::combine(const WeightedMoments& that)
+{
+    // StatisticsAccumulator::operator+(), with weights in place of counts
+    if (that.weight <= 0.0)
+    {
+        return;
+    }
+    if (moments_.weight <= 0.0)
+    {
+        moments_ = that;
+        return;
+    }
+
+    const double a_n = moments_.weight;
+    const double b_n = that.weight;
+    const double c_n = a_n + b_n;
+
+    const WeightedMoments& a = moments_;
+    const WeightedMoments& b = that;
+
+    const double delta  = b.moment1 - a.moment1;
+    const double delta2 = delta * delta;
+    const double delta3 = delta * delta2;
+    const double delta4 = delta2 * delta2;
+
+    WeightedMoments combined;
+
+    combined.weight = c_n;
+
+    combined.moment1 = (a_n * a.moment1 + b_n * b.moment1) / c_n;
+
+    combined.abs_moment1 = (a_n * a.abs_moment1 + b_n * b.abs_moment1) / c_n;
+
+    combined.moment2 = a.moment2 + b.moment2 + delta2 * a_n * b_n / c_n;
+
+    combined.moment3 = a.moment3 + b.moment3 + delta3 * a_n * b_n * (a_n - b_n) / (c_n * c_n);
+    combined.moment3 += 3.0 * delta * (a_n * b.moment2 - b_n * a.moment2) / c_n;
+
+    combined.moment4 = a.moment4 + b.moment4 +
+                       delta4 * a_n * b_n * (a_n * a_n - a_n * b_n + b_n * b_n) / (c_n * c_n * c_n);
+    combined.moment4 += 6.0 * delta2 * (a_n * a_n * b.moment2 + b_n * b_n * a.moment2) /
+                            (c_n * c_n) +
+                        4.0 * delta * (a_n * b.moment3 - b_n * a.moment3) / c_n;
+
+    moments_ = combined;
+}
+
+void ExponentialStatisticsAccumulator::add(const float& value)
+{
+    add(time_ + 1.0, value);
+}
+
+void ExponentialStatisticsAccumulator::add(const double& timestamp, const float& value)
+{
+    double weight = 1.0;
+    if (count_ == 0 || timestamp >= time_)
+    {
+        decay(exp2(-(timestamp - time_) / half_life_));
+        time_ = timestamp;
+    }
+    else
+    {
+        weight = exp2(-(time_ - timestamp) / half_life_);
+    }
+
+    ++count_;
+    minimum_ = std::min(value, minimum_);
+    maximum_ = std::max(value, maximum_);
+
+    const double dVal = static_cast<double>(value);
+    combine({weight, dVal, fabs(dVal), 0.0, 0.0, 0.0});
+}
+
+void ExponentialStatisticsAccumulator::add(const float* values, std::size_t number_of_values)
+{
+    // Lane weights run backwards from the newest value of the block, which
+    // has weight 1, so they only ever shrink.
+    const double lane_step = pow(decay_per_tick_, static_cast<double>(kLanes));
+
+    for (std::size_t first = 0; first < number_of_values; first += kBlockSize)
+    {
+        const float* block     = values + first;
+        const std::size_t size = std::min(kBlockSize, number_of_values - first);
+        const std::size_t tail = size % kLanes; // the oldest values, outside the lanes
+
+        // first pass: extremes, weights, weighted sums
+
+        double start[kLanes];
+        double weight[kLanes], sum[kLanes], abs_sum[kLanes];
+        float minimum[kLanes], maximum[kLanes];
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            start[lane]   = pow(decay_per_tick_, static_cast<double>(kLanes - 1 - lane));
+            weight[lane]  = 0.0;
+            sum[lane]     = 0.0;
+            abs_sum[lane] = 0.0;
+            minimum[lane] = std::numeric_limits<float>::max();
+            maximum[lane] = -std::numeric_limits<float>::max();
+        }
+
+        double lane_weight[kLanes];
+        std::copy(start, start + kLanes, lane_weight);
+        for (std::size_t i = size; i > tail; i -= kLanes)
+        {
+            for (std::size_t lane = 0; lane < kLanes; ++lane)
+            {
+                const double value = static_cast<double>(block[i - kLanes + lane]);
+                minimum[lane]      = std::min(block[i - kLanes + lane], minimum[lane]);
+                maximum[lane]      = std::max(block[i - kLanes + lane], maximum[lane]);
+                weight[lane] += lane_weight[lane];
+                sum[lane] += lane_weight[lane] * value;
+                abs_sum[lane] += lane_weight[lane] * fabs(value);
+                lane_weight[lane] *= lane_step;
+            }
+        }
+        double tail_weight = pow(decay_per_tick_, static_cast<double>(size - tail));
+        for (std::size_t i = tail; i > 0; --i)
+        {
+            const double value = static_cast<double>(block[i - 1]);
+            minimum[0]         = std::min(block[i - 1], minimum[0]);
+            maximum[0]         = std::max(block[i - 1], maximum[0]);
+            weight[0] += tail_weight;
+            sum[0] += tail_weight * value;
+            abs_sum[0] += tail_weight * fabs(value);
+            tail_weight *= decay_per_tick_;
+        }
+
+        WeightedMoments moments = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        double total            = 0.0;
+        double abs_total        = 0.0;
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            minimum_ = std::min(minimum[lane], minimum_);
+            maximum_ = std::max(maximum[lane], maximum_);
+            moments.weight += weight[lane];
+            total += sum[lane];
+            abs_total += abs_sum[lane];
+        }
+        const double mean   = total / moments.weight;
+        moments.moment1     = mean;
+        moments.abs_moment1 = abs_total / moments.weight;
+
+        // second pass: weighted central moments about the block mean
+
+        double m2[kLanes], m3[kLanes], m4[kLanes];
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            m2[lane] = 0.0;
+            m3[lane] = 0.0;
+            m4[lane] = 0.0;
+        }
+        std::copy(start, start + kLanes, lane_weight);
+        for (std::size_t i = size; i > tail; i -= kLanes)
+        {
+            for (std::size_t lane = 0; lane < kLanes; ++lane)
+            {
+                const double delta  = static_cast<double>(block[i - kLanes + lane]) - mean;
+                const double delta2 = delta * delta;
+                m2[lane] += lane_weight[lane] * delta2;
+                m3[lane] += lane_weight[lane] * delta2 * delta;
+                m4[lane] += lane_weight[lane] * delta2 * delta2;
+                lane_weight[lane] *= lane_step;
+            }
+        }
+        tail_weight = pow(decay_per_tick_, static_cast<double>(size - tail));
+        for (std::size_t i = tail; i > 0; --i)
+        {
+            const double delta  = static_cast<double>(block[i - 1]) - mean;
+            const double delta2 = delta * delta;
+            m2[0] += tail_weight * delta2;
+            m3[0] += tail_weight * delta2 * delta;
+            m4[0] += tail_weight * delta2 * delta2;
+            tail_weight *= decay_per_tick_;
+        }
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            moments.moment2 += m2[lane];
+            moments.moment3 += m3[lane];
+            moments.moment4 += m4[lane];
+        }
+
+        // age the accumulated moments past the block, then combine
+        decay(pow(decay_per_tick_, static_cast<double>(size)));
+        time_ += static_cast<double>(size);
+        count_ += size;
+        combine(moments);
+    }
+}
+
+double ExponentialStatisticsAccumulator::half_life() const
+{
+    return half_life_;
+}
+
+double ExponentialStatisticsAccumulator::time() const
+{
+    return time_;
+}
+
+double ExponentialStatisticsAccumulator::weight() const
+{
+    return moments_.weight;
+}
+
+std::size_t ExponentialStatisticsAccumulator::count() const
+{
+    return count_;
+}
+
+float ExponentialStatisticsAccumulator::minimum() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return minimum_;
+}
+
+float ExponentialStatisticsAccumulator::maximum() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return maximum_;
+}
+
+float ExponentialStatisticsAccumulator::mean() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return static_cast<float>(moments_.moment1);
+}
+
+float ExponentialStatisticsAccumulator::absolute_mean() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return static_cast<float>(moments_.abs_moment1);
+}
+
+float ExponentialStatisticsAccumulator::quadratic_mean() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    const double mean2 = moments_.moment1 * moments_.moment1;
+    const double sd2   = moments_.moment2 / moments_.weight;
+    const double rms   = sqrt(mean2 + sd2);
+    return static_cast<float>(rms);
+}
+
+float ExponentialStatisticsAccumulator::standard_deviation() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    const double std_dev = sqrt(moments_.moment2 / moments_.weight);
+    return static_cast<float>(std_dev);
+}
+
+float ExponentialStatisticsAccumulator::skewness() const
+{
+    if (count_ == 0 || moments_.moment2 == 0.0)
+    {
+        return stats::undefined();
+    }
+
+    const double skew = (sqrt(moments_.weight) * moments_.moment3) / pow(moments_.moment2, 1.5);
+    return static_cast<float>(skew);
+}
+
+float ExponentialStatisticsAccumulator::kurtosis() const
+{
+    if (count_ == 0 || moments_.moment2 == 0.0)
+    {
+        return stats::undefined();
+    }
+
+    const double kurt =
+        (moments_.weight * moments_.moment4) / (moments_.moment2 * moments_.moment2) - 3.0;
+    return static_cast<float>(kurt);
+}
+
+} // namespace stats
@@ -0,0 +1,311 @@
+#include "stats/FrequentValuesSketch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace // unnamed namespace
+{
+
+const std::int32_t kEmpty = -1;
+
+// Returns one bit pattern for 0 and -0, and one for all NaN values.
+std::uint32_t key(const float& value)
+{
+    std::uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7fffffffU) == 0)
+    {
+        return 0;
+    }
+    if ((bits & 0x7fffffffU) > 0x7f800000U)
+    {
+        return 0x7fc00000U;
+    }
+    return bits;
+}
+
+float value(const std::uint32_t& key)
+{
+    float value = 0.F;
+    memcpy(&value, &key, sizeof(value));
+    return value;
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+FrequentValuesSketch::FrequentValuesSketch(std::size_t capacity)
+    : capacity_(std::max<std::size_t>(capacity, 1))
+    , index_bits_(1)
+    , count_(0)
+{
+    // keep the index at most half full
+    while ((std::size_t(1) << index_bits_) < 2 * capacity_)
+    {
+        ++index_bits_;
+    }
+    index_.assign(std::size_t(1) << index_bits_, kEmpty);
+
+    keys_.reserve(capacity_);
+    counts_.reserve(capacity_);
+    errors_.reserve(capacity_);
+    slots_.reserve(capacity_);
+}
+
+std::size_t FrequentValuesSketch::home(const std::uint32_t& key) const
+{
+    // Fibonacci hashing, taking the high bits of the product
+    return static_cast<std::size_t>((key * 2654435769U) >> (32 - index_bits_));
+}
+
+std::size_t FrequentValuesSketch::find(const std::uint32_t& key) const
+{
+    // returns the slot holding the key, or the empty slot where it belongs
+    const std::size_t mask = index_.size() - 1;
+    std::size_t slot       = home(key);
+    while (index_[slot] != kEmpty && keys_[static_cast<std::size_t>(index_[slot])] != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void FrequentValuesSketch::insert(const std::size_t& slot, const std::size_t& position)
+{
+    index_[slot]     = static_cast<std::int32_t>(position);
+    slots_[position] = static_cast<std::uint32_t>(slot);
+}
+
+void FrequentValuesSketch::erase(std::size_t slot)
+{
+    // Shift later entries of the probe sequence back, so no lookup crosses
+    // an empty slot before finding its key.
+    const std::size_t mask = index_.size() - 1;
+    std::size_t next       = slot;
+    for (;;)
+    {
+        next = (next + 1) & mask;
+        if (index_[next] == kEmpty)
+        {
+            break;
+        }
+        const std::size_t next_home = home(keys_[static_cast<std::size_t>(index_[next])]);
+        const bool movable          = next > slot ? (next_home <= slot || next_home > next)
+                                                  : (next_home <= slot && next_home > next);
+        if (movable)
+        {
+            insert(slot, static_cast<std::size_t>(index_[next]));
+            slot = next;
+        }
+    }
+    index_[slot] = kEmpty;
+}
+
+void FrequentValuesSketch::swap(const std::size_t& a, const std::size_t& b)
+{
+    std::swap(keys_[a], keys_[b]);
+    std::swap(counts_[a], counts_[b]);
+    std::swap(errors_[a], errors_[b]);
+    std::swap(slots_[a], slots_[b]);
+    index_[slots_[a]] = static_cast<std::int32_t>(a);
+    index_[slots_[b]] = static_cast<std::int32_t>(b);
+}
+
+void FrequentValuesSketch::sift_down(std::size_t position)
+{
+    const std::size_t size = counts_.size();
+    for (;;)
+    {
+        const std::size_t left = 2 * position + 1;
+        if (left >= size)
+        {
+            return;
+        }
+        const std::size_t right    = left + 1;
+        const std::size_t smallest = right < size && counts_[right] < counts_[left] ? right : left;
+        if (counts_[position] <= counts_[smallest])
+        {
+            return;
+        }
+        swap(position, smallest);
+        position = smallest;
+    }
+}
+
+void FrequentValuesSketch::sift_up(std::size_t position)
+{
+    while (position > 0)
+    {
+        const std::size_t parent = (position - 1) / 2;
+        if (counts_[parent] <= counts_[position])
+        {
+            return;
+        }
+        swap(position, parent);
+        position = parent;
+    }
+}
+
+void FrequentValuesSketch::add(const std::uint32_t& key, const std::uint64_t& count)
+{
+    count_ += count;
+
+    const std::size_t slot = find(key);
+    if (index_[slot] != kEmpty)
+    {
+        const std::size_t position = static_cast<std::size_t>(index_[slot]);
+        counts_[position] += count;
+        sift_down(position);
+    }
+    else if (keys_.size() < capacity_)
+    {
+        keys_.push_back(key);
+        counts_.push_back(count);
+        errors_.push_back(0);
+        slots_.push_back(0);
+        insert(slot, keys_.size() - 1);
+        sift_up(keys_.size() - 1);
+    }
+    else
+    {
+        // replace the value with the lowest count
+        erase(slots_[0]);
+        keys_[0]   = key;
+        errors_[0] = counts_[0];
+        counts_[0] += count;
+        insert(find(key), 0);
+        sift_down(0);
+    }
+}
+
+void FrequentValuesSketch::add(const float& value)
+{
+    add(key(value), 1);
+}
+
+void FrequentValuesSketch::add(const float* values, std::size_t number_of_values)
+{
+    std::size_t first = 0;
+    while (first < number_of_values)
+    {
+        const std::uint32_t run_key = key(values[first]);
+        std::size_t end             = first + 1;
+        while (end < number_of_values && key(values[end]) == run_key)
+        {
+            ++end;
+        }
+        add(run_key, end - first);
+        first = end;
+    }
+}
+
+std::uint64_t FrequentValuesSketch::count() const
+{
+    return count_;
+}
+
+std::uint64_t FrequentValuesSketch::count(const float& value) const
+{
+    const std::size_t slot = find(key(value));
+    return index_[slot] != kEmpty ? counts_[static_cast<std::size_t>(index_[slot])] : 0;
+}
+
+std::size_t FrequentValuesSketch::size() const
+{
+    return keys_.size();
+}
+
+std::size_t FrequentValuesSketch::capacity() const
+{
+    return capacity_;
+}
+
+std::vector<FrequentValue> FrequentValuesSketch::top(std::size_t number_of_values) const
+{
+    std::vector<FrequentValue> frequent;
+    frequent.reserve(keys_.size());
+    for (std::size_t i = 0; i < keys_.size(); ++i)
+    {
+        frequent.push_back({value(keys_[i]), counts_[i], errors_[i]});
+    }
+
+    number_of_values = std::min(number_of_values, frequent.size());
+    std::partial_sort(frequent.begin(),
+                      frequent.begin() + static_cast<std::ptrdiff_t>(number_of_values),
+                      frequent.end(), [](const FrequentValue& a, const FrequentValue& b)
+                      { return a.count > b.count; });
+    frequent.resize(number_of_values);
+    return frequent;
+}
+
+FrequentValuesSketch FrequentValuesSketch::operator+(const FrequentValuesSketch& that) const
+{
+    // The lowest count of a full sketch bounds the count of any value it does
+    // not track.
+    const std::uint64_t this_bound =
+        this->keys_.size() == this->capacity_ ? this->counts_.front() : 0;
+    const std::uint64_t that_bound =
+        that.keys_.size() == that.capacity_ ? that.counts_.front() : 0;
+
+    struct Estimate
+    {
+        std::uint64_t count;
+        std::uint64_t error;
+        bool in_this;
+        bool in_that;
+    };
+    std::unordered_map<std::uint32_t, Estimate> estimates;
+    for (std::size_t i = 0; i < this->keys_.size(); ++i)
+    {
+        estimates[this->keys_[i]] = {this->counts_[i], this->errors_[i], true, false};
+    }
+    for (std::size_t i = 0; i < that.keys_.size(); ++i)
+    {
+        Estimate& estimate = estimates[that.keys_[i]];
+        estimate.count += that.counts_[i];
+        estimate.error += that.errors_[i];
+        estimate.in_that = true;
+    }
+
+    using Entry = std::pair<std::uint32_t, Estimate>;
+    std::vector<Entry> ranked;
+    ranked.reserve(estimates.size());
+    for (Entry entry : estimates)
+    {
+        const std::uint64_t bound = (entry.second.in_this ? 0 : this_bound) +
+                                    (entry.second.in_that ? 0 : that_bound);
+        entry.second.count += bound;
+        entry.second.error += bound;
+        ranked.push_back(entry);
+    }
+
+    const std::size_t kept = std::min(capacity_, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + static_cast<std::ptrdiff_t>(kept),
+                      ranked.end(), [](const Entry& a, const Entry& b)
+                      { return a.second.count > b.second.count; });
+
+    FrequentValuesSketch combined(capacity_);
+    for (std::size_t i = 0; i < kept; ++i)
+    {
+        combined.keys_.push_back(ranked[i].first);
+        combined.counts_.push_back(ranked[i].second.count);
+        combined.errors_.push_back(ranked[i].second.error);
+        combined.slots_.push_back(0);
+        combined.insert(combined.find(ranked[i].first), i);
+        combined.sift_up(i);
+    }
+    combined.count_ = this->count_ + that.count_;
+    return combined;
+}
+
+FrequentValuesSketch& FrequentValuesSketch::operator+=(const FrequentValuesSketch& rhs)
+{
+    FrequentValuesSketch combined = *this + rhs;
+    *this                         = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,155 @@
+#include "stats/HistogramAccumulator.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace // unnamed namespace
+{
+
+// Values per block of bin indexes in the array add().
+const std::size_t kBlockSize = 1024;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+HistogramAccumulator::HistogramAccumulator(float lower, float upper, std::size_t number_of_bins)
+    : lower_(lower)
+    , upper_(upper)
+    , bins_per_unit_(static_cast<float>(std::max<std::size_t>(number_of_bins, 1)) /
+                     (upper - lower))
+    , number_of_bins_(std::max<std::size_t>(number_of_bins, 1))
+    , counts_(kLanes * (number_of_bins_ + 2), 0)
+    , count_(0)
+{
+}
+
+std::int32_t HistogramAccumulator::slot(const float& value) const
+{
+    // Branch free, so the loop over a block vectorizes. Negative positions
+    // and NaN go to -1, then everything shifts up past the underflow slot.
+    const float position = (value - lower_) * bins_per_unit_;
+    const float clamped  = position >= 0.F ? position : -1.F;
+    return static_cast<std::int32_t>(std::min(clamped, static_cast<float>(number_of_bins_))) + 1;
+}
+
+std::uint64_t HistogramAccumulator::slot_count(const std::size_t& slot) const
+{
+    const std::size_t stride = number_of_bins_ + 2;
+
+    std::uint64_t count = 0;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        count += counts_[lane * stride + slot];
+    }
+    return count;
+}
+
+void HistogramAccumulator::add(const float& value)
+{
+    ++counts_[static_cast<std::size_t>(slot(value))];
+    ++count_;
+}
+
+void HistogramAccumulator::add(const float* values, std::size_t number_of_values)
+{
+    const std::size_t stride = number_of_bins_ + 2;
+    std::uint64_t* lanes[kLanes];
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        lanes[lane] = counts_.data() + lane * stride;
+    }
+
+    std::array<std::int32_t, kBlockSize> slots;
+    for (std::size_t first = 0; first < number_of_values; first += kBlockSize)
+    {
+        const std::size_t block_size = std::min(kBlockSize, number_of_values - first);
+        const float* block           = values + first;
+
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            slots[i] = slot(block[i]);
+        }
+
+        const std::size_t lanes_end = block_size - block_size % kLanes;
+        for (std::size_t i = 0; i < lanes_end; i += kLanes)
+        {
+            for (std::size_t lane = 0; lane < kLanes; ++lane)
+            {
+                ++lanes[lane][slots[i + lane]];
+            }
+        }
+        for (std::size_t i = lanes_end; i < block_size; ++i)
+        {
+            ++lanes[0][slots[i]];
+        }
+    }
+    count_ += number_of_values;
+}
+
+std::uint64_t HistogramAccumulator::count() const
+{
+    return count_;
+}
+
+std::uint64_t HistogramAccumulator::count(const std::size_t& bin) const
+{
+    return bin < number_of_bins_ ? slot_count(bin + 1) : 0;
+}
+
+std::uint64_t HistogramAccumulator::underflow() const
+{
+    return slot_count(0);
+}
+
+std::uint64_t HistogramAccumulator::overflow() const
+{
+    return slot_count(number_of_bins_ + 1);
+}
+
+std::size_t HistogramAccumulator::number_of_bins() const
+{
+    return number_of_bins_;
+}
+
+float HistogramAccumulator::lower_bound(const std::size_t& bin) const
+{
+    return lower_ + (upper_ - lower_) * static_cast<float>(bin) /
+                        static_cast<float>(number_of_bins_);
+}
+
+HistogramAccumulator HistogramAccumulator::operator+(const HistogramAccumulator& that) const
+{
+    HistogramAccumulator combined = *this;
+    if (this->lower_ == that.lower_ && this->upper_ == that.upper_ &&
+        this->number_of_bins_ == that.number_of_bins_)
+    {
+        for (std::size_t i = 0; i < combined.counts_.size(); ++i)
+        {
+            combined.counts_[i] += that.counts_[i];
+        }
+    }
+    else
+    {
+        // re-bin the other histogram's counts at its bin midpoints
+        combined.counts_[0] += that.underflow();
+        combined.counts_[number_of_bins_ + 1] += that.overflow();
+        for (std::size_t bin = 0; bin < that.number_of_bins_; ++bin)
+        {
+            const float midpoint = 0.5F * (that.lower_bound(bin) + that.lower_bound(bin + 1));
+            combined.counts_[static_cast<std::size_t>(combined.slot(midpoint))] += that.count(bin);
+        }
+    }
+    combined.count_ += that.count_;
+    return combined;
+}
+
+HistogramAccumulator& HistogramAccumulator::operator+=(const HistogramAccumulator& rhs)
+{
+    HistogramAccumulator combined = *this + rhs;
+    *this                         = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,190 @@
+#include "stats/HyperLogLog.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace // unnamed namespace
+{
+
+// Values per block of hashes in the array add().
+const std::size_t kBlockSize = 1024;
+
+const std::size_t kMinimumPrecision = 4;
+const std::size_t kMaximumPrecision = 18;
+
+// Hashes the bit pattern of the value, with the MurmurHash3 64-bit finalizer.
+// Branch free, so the loop over a block vectorizes.
+inline std::uint64_t hash(const float& value)
+{
+    std::uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+
+    // one pattern for 0 and -0, and one for all NaN values
+    bits = (bits & 0x7fffffffU) == 0 ? 0 : bits;
+    bits = (bits & 0x7fffffffU) > 0x7f800000U ? 0x7fc00000U : bits;
+
+    std::uint64_t h = bits;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Ertl's sigma and tau functions, correcting for registers still at zero and
+// registers at the maximum rank.
+double sigma(double x)
+{
+    if (x == 1.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    double y = 1.0;
+    double z = x;
+    double previous;
+    do
+    {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+double tau(double x)
+{
+    if (x == 0.0 || x == 1.0)
+    {
+        return 0.0;
+    }
+    double y = 1.0;
+    double z = 1.0 - x;
+    double previous;
+    do
+    {
+        x        = sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+HyperLogLog::HyperLogLog(std::size_t precision)
+    : precision_(std::min(std::max(precision, kMinimumPrecision), kMaximumPrecision))
+    , registers_(std::size_t(1) << precision_, 0)
+{
+}
+
+void HyperLogLog::add_hash(const std::uint64_t& hash)
+{
+    // The first bits choose the register. A marker bit below the rest limits
+    // the rank to 65 - precision.
+    const std::size_t index  = static_cast<std::size_t>(hash >> (64 - precision_));
+    const std::uint64_t rest = (hash << precision_) | (std::uint64_t(1) << (precision_ - 1));
+    const std::uint8_t rank  = static_cast<std::uint8_t>(__builtin_clzll(rest) + 1);
+    registers_[index]        = std::max(registers_[index], rank);
+}
+
+void HyperLogLog::add(const float& value)
+{
+    add_hash(hash(value));
+}
+
+void HyperLogLog::add(const float* values, std::size_t number_of_values)
+{
+    std::array<std::uint64_t, kBlockSize> hashes;
+    for (std::size_t first = 0; first < number_of_values; first += kBlockSize)
+    {
+        const std::size_t block_size = std::min(kBlockSize, number_of_values - first);
+        const float* block           = values + first;
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            hashes[i] = hash(block[i]);
+        }
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            add_hash(hashes[i]);
+        }
+    }
+}
+
+double HyperLogLog::cardinality() const
+{
+    const std::size_t maximum_rank = 65 - precision_;
+
+    std::array<std::size_t, 66> histogram{};
+    for (const std::uint8_t& rank : registers_)
+    {
+        ++histogram[rank];
+    }
+
+    const double m = static_cast<double>(registers_.size());
+    double z       = m * tau(1.0 - static_cast<double>(histogram[maximum_rank]) / m);
+    for (std::size_t rank = maximum_rank - 1; rank >= 1; --rank)
+    {
+        z = 0.5 * (z + static_cast<double>(histogram[rank]));
+    }
+    z += m * sigma(static_cast<double>(histogram[0]) / m);
+
+    return m * m / (2.0 * log(2.0) * z);
+}
+
+std::size_t HyperLogLog::precision() const
+{
+    return precision_;
+}
+
+double HyperLogLog::relative_standard_error() const
+{
+    return 1.04 / sqrt(static_cast<double>(registers_.size()));
+}
+
+HyperLogLog HyperLogLog::operator+(const HyperLogLog& that) const
+{
+    const HyperLogLog& coarse = this->precision_ <= that.precision_ ? *this : that;
+    const HyperLogLog& fine   = this->precision_ <= that.precision_ ? that : *this;
+
+    HyperLogLog combined = coarse;
+
+    // Fold the finer registers. The index bits the coarse estimator does not
+    // use become the leading bits of its rank.
+    const std::size_t extra_bits = fine.precision_ - coarse.precision_;
+    for (std::size_t index = 0; index < fine.registers_.size(); ++index)
+    {
+        const std::uint8_t rank = fine.registers_[index];
+        if (rank == 0)
+        {
+            continue;
+        }
+        const std::size_t dropped = index & ((std::size_t(1) << extra_bits) - 1);
+        std::uint8_t folded       = static_cast<std::uint8_t>(rank + extra_bits);
+        if (dropped != 0)
+        {
+            folded = static_cast<std::uint8_t>(
+                __builtin_clzll(static_cast<std::uint64_t>(dropped) << (64 - extra_bits)) + 1);
+        }
+        std::uint8_t& target = combined.registers_[index >> extra_bits];
+        target               = std::max(target, folded);
+    }
+    return combined;
+}
+
+HyperLogLog& HyperLogLog::operator+=(const HyperLogLog& rhs)
+{
+    HyperLogLog combined = *this + rhs;
+    *this                = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,74 @@
+#include "stats/IntervalStatisticsAccumulator.hpp"
+
+#include <thread>
+
+namespace stats
+{
+
+IntervalStatisticsAccumulator::Slot::Slot()
+    : busy{{false}, {false}}
+{
+}
+
+IntervalStatisticsAccumulator::IntervalStatisticsAccumulator(std::size_t number_of_writers)
+    : slots_(number_of_writers)
+    , epoch_(0)
+{
+}
+
+template <typename AddT>
+void IntervalStatisticsAccumulator::add_in_current_epoch(Slot& slot, const AddT& add)
+{
+    // Announce the write, then confirm the epoch did not flip meanwhile. The
+    // sequentially consistent pair guarantees the exporter either sees the
+    // announcement or this writer sees the new epoch.
+    for (;;)
+    {
+        const unsigned epoch = epoch_.load();
+        slot.busy[epoch].store(true);
+        if (epoch_.load() == epoch)
+        {
+            add(slot.statistics[epoch]);
+            slot.busy[epoch].store(false, std::memory_order_release);
+            return;
+        }
+        slot.busy[epoch].store(false, std::memory_order_release);
+    }
+}
+
+void IntervalStatisticsAccumulator::add(std::size_t writer, const float& value)
+{
+    add_in_current_epoch(slots_[writer],
+                         [&value](StatisticsAccumulator& statistics) { statistics.add(value); });
+}
+
+void IntervalStatisticsAccumulator::add(std::size_t writer, const float* values,
+                                        std::size_t number_of_values)
+{
+    add_in_current_epoch(slots_[writer],
+                         [values, number_of_values](StatisticsAccumulator& statistics)
+                         { statistics.add(values, number_of_values); });
+}
+
+StatisticsAccumulator IntervalStatisticsAccumulator::snapshot_and_reset()
+{
+    std::lock_guard<std::mutex> lock(exporter_mutex_);
+
+    const unsigned previous = epoch_.load(std::memory_order_relaxed);
+    epoch_.store(1U - previous);
+
+    StatisticsAccumulator interval;
+    for (Slot& slot : slots_)
+    {
+        while (slot.busy[previous].load())
+        {
+            std::this_thread::yield();
+        }
+        interval += slot.statistics[previous];
+        slot.statistics[previous] = StatisticsAccumulator();
+    }
+
+    return interval;
+}
+
+} // namespace stats
@@ -0,0 +1,232 @@
+#include "stats/KllSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Ratio of a compactor's capacity to the capacity of the one above it.
+const double kCapacityRatio = 2.0 / 3.0;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+KllSketch::KllSketch(std::size_t k, std::uint64_t seed)
+    : k_(std::max<std::size_t>(k, 8))
+    , size_(0)
+    , max_size_(0)
+    , count_(0)
+    , random_state_(seed == 0 ? 1 : seed)
+{
+    grow();
+}
+
+std::size_t KllSketch::capacity(std::size_t level) const
+{
+    const double depth = static_cast<double>(compactors_.size() - level - 1);
+    return static_cast<std::size_t>(ceil(pow(kCapacityRatio, depth) * static_cast<double>(k_))) +
+           1;
+}
+
+void KllSketch::grow()
+{
+    compactors_.emplace_back();
+
+    max_size_ = 0;
+    for (std::size_t level = 0; level < compactors_.size(); ++level)
+    {
+        max_size_ += capacity(level);
+    }
+}
+
+bool KllSketch::coin_flip()
+{
+    // xorshift64
+    random_state_ ^= random_state_ << 13U;
+    random_state_ ^= random_state_ >> 7U;
+    random_state_ ^= random_state_ << 17U;
+    return (random_state_ & 1U) != 0;
+}
+
+void KllSketch::compress()
+{
+    // Compact the lowest full compactor, promoting a random half of its sorted
+    // values. An odd value out stays behind.
+    for (std::size_t level = 0; level < compactors_.size(); ++level)
+    {
+        if (compactors_[level].size() < capacity(level))
+        {
+            continue;
+        }
+        if (level + 1 == compactors_.size())
+        {
+            grow();
+        }
+
+        std::vector<float>& compactor = compactors_[level];
+        std::vector<float>& above     = compactors_[level + 1];
+
+        const bool keep_last = compactor.size() % 2 == 1;
+        const float last     = compactor.back();
+        if (keep_last)
+        {
+            compactor.pop_back();
+        }
+
+        std::sort(compactor.begin(), compactor.end());
+        for (std::size_t i = coin_flip() ? 1 : 0; i < compactor.size(); i += 2)
+        {
+            above.push_back(compactor[i]);
+        }
+        size_ -= compactor.size() / 2;
+
+        compactor.clear();
+        if (keep_last)
+        {
+            compactor.push_back(last);
+        }
+        return;
+    }
+}
+
+void KllSketch::add(const float& value)
+{
+    add(&value, 1);
+}
+
+void KllSketch::add(const float* values, std::size_t number_of_values)
+{
+    count_ += number_of_values;
+    while (number_of_values > 0)
+    {
+        const std::size_t room  = max_size_ > size_ ? max_size_ - size_ : 0;
+        const std::size_t taken = std::min(number_of_values, std::max<std::size_t>(room, 1));
+        compactors_[0].insert(compactors_[0].end(), values, values + taken);
+        size_ += taken;
+        values += taken;
+        number_of_values -= taken;
+
+        while (size_ >= max_size_)
+        {
+            compress();
+        }
+    }
+}
+
+std::uint64_t KllSketch::count() const
+{
+    return count_;
+}
+
+std::size_t KllSketch::size() const
+{
+    return size_;
+}
+
+double KllSketch::normalized_rank_error() const
+{
+    // Empirical double-sided bound at 99% confidence, from the Apache
+    // DataSketches characterisation of KLL.
+    return 2.296 / pow(static_cast<double>(k_), 0.9723);
+}
+
+double KllSketch::rank(const float& value) const
+{
+    if (count_ == 0)
+    {
+        return 0.0;
+    }
+
+    std::uint64_t weight = 1;
+    std::uint64_t below  = 0;
+    std::uint64_t total  = 0;
+    for (const std::vector<float>& compactor : compactors_)
+    {
+        for (const float& retained : compactor)
+        {
+            below += retained <= value ? weight : 0;
+        }
+        total += compactor.size() * weight;
+        weight *= 2;
+    }
+    return static_cast<double>(below) / static_cast<double>(total);
+}
+
+float KllSketch::quantile(const double& probability) const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    std::vector<std::pair<float, std::uint64_t>> weighted;
+    weighted.reserve(size_);
+    std::uint64_t weight = 1;
+    std::uint64_t total  = 0;
+    for (const std::vector<float>& compactor : compactors_)
+    {
+        for (const float& retained : compactor)
+        {
+            weighted.emplace_back(retained, weight);
+        }
+        total += compactor.size() * weight;
+        weight *= 2;
+    }
+    std::sort(weighted.begin(), weighted.end());
+
+    const double clamped     = std::min(std::max(probability, 0.0), 1.0);
+    const double target      = clamped * static_cast<double>(total);
+    std::uint64_t cumulative = 0;
+    for (const auto& item : weighted)
+    {
+        cumulative += item.second;
+        if (static_cast<double>(cumulative) >= target)
+        {
+            return item.first;
+        }
+    }
+    return weighted.back().first;
+}
+
+KllSketch KllSketch::operator+(const KllSketch& that) const
+{
+    KllSketch combined(std::min(this->k_, that.k_), this->random_state_ ^ that.random_state_);
+
+    while (combined.compactors_.size() <
+           std::max(this->compactors_.size(), that.compactors_.size()))
+    {
+        combined.grow();
+    }
+    for (const KllSketch* sketch : {this, &that})
+    {
+        for (std::size_t level = 0; level < sketch->compactors_.size(); ++level)
+        {
+            const std::vector<float>& compactor = sketch->compactors_[level];
+            combined.compactors_[level].insert(combined.compactors_[level].end(),
+                                               compactor.begin(), compactor.end());
+            combined.size_ += compactor.size();
+        }
+    }
+    combined.count_ = this->count_ + that.count_;
+
+    while (combined.size_ >= combined.max_size_)
+    {
+        combined.compress();
+    }
+    return combined;
+}
+
+KllSketch& KllSketch::operator+=(const KllSketch& rhs)
+{
+    KllSketch combined = *this + rhs;
+    *this              = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,56 @@
+#include "LogLinearBuckets.hpp"
+
+#include <cstring>
+
+namespace // unnamed namespace
+{
+
+const unsigned kMantissaBits = 23;
+
+} // unnamed namespace
+
+namespace stats
+{
+namespace detail
+{
+
+std::int32_t log_linear_key(const float& value, const unsigned& precision_bits)
+{
+    std::int32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits < 0 ? 0 : bits >> (kMantissaBits - precision_bits);
+}
+
+float log_linear_lower_bound(const std::int32_t& key, const unsigned& precision_bits)
+{
+    const std::int32_t bits = key << (kMantissaBits - precision_bits);
+    float value             = 0.F;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float log_linear_midpoint(const std::int32_t& key, const unsigned& precision_bits)
+{
+    const float lower = log_linear_lower_bound(key, precision_bits);
+    const float upper = log_linear_lower_bound(key + 1, precision_bits);
+    return lower + (upper - lower) / 2.F;
+}
+
+void log_linear_indexes(const float* values, std::size_t number_of_values,
+                        const unsigned& precision_bits, const std::int32_t& lowest_key,
+                        const std::int32_t& highest_key, std::uint32_t* indexes)
+{
+    const unsigned shift = kMantissaBits - precision_bits;
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+        std::int32_t bits = 0;
+        memcpy(&bits, &values[i], sizeof(bits));
+        std::int32_t key = bits >> shift;
+        key              = key < lowest_key ? lowest_key : key;
+        key              = key > highest_key ? highest_key : key;
+        indexes[i]       = static_cast<std::uint32_t>(key - lowest_key);
+    }
+}
+
+} // namespace detail
+} // namespace stats
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace stats
+{
+namespace detail
+{
+
+// Log-linear bucketing straight from the 32-bit float bit pattern. Above the
+// sign bit, a positive float's bits are its exponent then its mantissa, so
+// dropping all but the top precision_bits of the mantissa leaves a key that
+// grows with the value, with 2^precision_bits linear buckets per power of two.
+
+std::int32_t log_linear_key(const float& value, const unsigned& precision_bits);
+
+float log_linear_lower_bound(const std::int32_t& key, const unsigned& precision_bits);
+
+float log_linear_midpoint(const std::int32_t& key, const unsigned& precision_bits);
+
+// Writes the bucket index, key - lowest_key clamped to 0 ... highest_key -
+// lowest_key, of each value. Zero, negative and tiny values go to bucket 0.
+// The loop is free of branches so the compiler vectorizes it.
+void log_linear_indexes(const float* values, std::size_t number_of_values,
+                        const unsigned& precision_bits, const std::int32_t& lowest_key,
+                        const std::int32_t& highest_key, std::uint32_t* indexes);
+
+} // namespace detail
+} // namespace stats
@@ -0,0 +1,170 @@
+#include "stats/LogLinearHistogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "LogLinearBuckets.hpp"
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values per bucket-index computation in the array record().
+const std::size_t kIndexBlockSize = 256;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+LogLinearHistogram::LogLinearHistogram(float lowest, float highest, unsigned precision_bits)
+    : precision_bits_(std::min(std::max(precision_bits, 1U), 23U))
+    , lowest_key_(detail::log_linear_key(std::max(lowest, std::numeric_limits<float>::min()),
+                                         precision_bits_))
+    , highest_key_(std::max(detail::log_linear_key(highest, precision_bits_), lowest_key_))
+    , counts_(static_cast<std::size_t>(highest_key_ - lowest_key_) + 1, 0)
+    , count_(0)
+    , minimum_(std::numeric_limits<float>::max())
+    , maximum_(-std::numeric_limits<float>::max())
+{
+}
+
+void LogLinearHistogram::record(const float& value)
+{
+    record(value, 1);
+}
+
+void LogLinearHistogram::record(const float& value, const std::uint64_t& count)
+{
+    std::uint32_t index = 0;
+    detail::log_linear_indexes(&value, 1, precision_bits_, lowest_key_, highest_key_, &index);
+    counts_[index] += count;
+    count_ += count;
+    minimum_ = std::min(value, minimum_);
+    maximum_ = std::max(value, maximum_);
+}
+
+void LogLinearHistogram::record(const float* values, std::size_t number_of_values)
+{
+    std::array<std::uint32_t, kIndexBlockSize> indexes;
+    for (std::size_t first = 0; first < number_of_values; first += kIndexBlockSize)
+    {
+        const std::size_t block_size = std::min(kIndexBlockSize, number_of_values - first);
+        detail::log_linear_indexes(values + first, block_size, precision_bits_, lowest_key_,
+                                   highest_key_, indexes.data());
+        for (std::size_t i = 0; i < block_size; ++i)
+        {
+            ++counts_[indexes[i]];
+            minimum_ = std::min(values[first + i], minimum_);
+            maximum_ = std::max(values[first + i], maximum_);
+        }
+    }
+    count_ += number_of_values;
+}
+
+std::uint64_t LogLinearHistogram::count() const
+{
+    return count_;
+}
+
+std::size_t LogLinearHistogram::size() const
+{
+    return counts_.size();
+}
+
+float LogLinearHistogram::minimum() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return minimum_;
+}
+
+float LogLinearHistogram::maximum() const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    return maximum_;
+}
+
+float LogLinearHistogram::quantile(const double& probability) const
+{
+    if (count_ == 0 || std::isnan(probability))
+    {
+        return stats::undefined();
+    }
+
+    if (probability <= 0.0)
+    {
+        return minimum_;
+    }
+    if (probability >= 1.0)
+    {
+        return maximum_;
+    }
+
+    const std::uint64_t rank =
+        std::max<std::uint64_t>(1, static_cast<std::uint64_t>(ceil(probability * count_)));
+
+    std::uint64_t cumulative = 0;
+    std::size_t index        = 0;
+    while (index + 1 < counts_.size() && cumulative + counts_[index] < rank)
+    {
+        cumulative += counts_[index];
+        ++index;
+    }
+
+    const std::int32_t key = lowest_key_ + static_cast<std::int32_t>(index);
+    const float middle     = detail::log_linear_midpoint(key, precision_bits_);
+    return std::min(std::max(middle, minimum_), maximum_);
+}
+
+LogLinearHistogram LogLinearHistogram::operator+(const LogLinearHistogram& that) const
+{
+    LogLinearHistogram combined = *this;
+
+    if (this->precision_bits_ == that.precision_bits_ &&
+        this->lowest_key_ == that.lowest_key_ && this->highest_key_ == that.highest_key_)
+    {
+        for (std::size_t index = 0; index < counts_.size(); ++index)
+        {
+            combined.counts_[index] += that.counts_[index];
+        }
+        combined.count_ += that.count_;
+    }
+    else
+    {
+        for (std::size_t index = 0; index < that.counts_.size(); ++index)
+        {
+            if (that.counts_[index] > 0)
+            {
+                const std::int32_t key = that.lowest_key_ + static_cast<std::int32_t>(index);
+                combined.record(detail::log_linear_midpoint(key, that.precision_bits_),
+                                that.counts_[index]);
+            }
+        }
+    }
+
+    if (that.count_ > 0)
+    {
+        combined.minimum_ = std::min(this->minimum_, that.minimum_);
+        combined.maximum_ = std::max(this->maximum_, that.maximum_);
+    }
+    return combined;
+}
+
+LogLinearHistogram& LogLinearHistogram::operator+=(const LogLinearHistogram& rhs)
+{
+    LogLinearHistogram combined = *this + rhs;
+    *this                       = combined;
+    return *this;
+}
+
+} // namespace stats
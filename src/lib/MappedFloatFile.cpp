@@ -0,0 +1,73 @@
+#include "stats/MappedFloatFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace stats
+{
+
+MappedFloatFile::MappedFloatFile(const std::string& path)
+    : mapping_(nullptr)
+    , mapped_bytes_(0)
+    , size_(0)
+    , open_(false)
+{
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return;
+    }
+
+    struct stat status = {};
+    if (fstat(descriptor, &status) == 0)
+    {
+        const std::size_t bytes = static_cast<std::size_t>(status.st_size);
+        if (bytes < sizeof(float))
+        {
+            open_ = true; // no values to map
+        }
+        else
+        {
+            void* mapping = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping != MAP_FAILED)
+            {
+                // every pass reads the values in order
+                madvise(mapping, bytes, MADV_SEQUENTIAL);
+                mapping_      = mapping;
+                mapped_bytes_ = bytes;
+                size_         = bytes / sizeof(float);
+                open_         = true;
+            }
+        }
+    }
+
+    // the mapping outlives the descriptor
+    close(descriptor);
+}
+
+MappedFloatFile::~MappedFloatFile()
+{
+    if (mapping_ != nullptr)
+    {
+        munmap(mapping_, mapped_bytes_);
+    }
+}
+
+bool MappedFloatFile::is_open() const
+{
+    return open_;
+}
+
+const float* MappedFloatFile::data() const
+{
+    return static_cast<const float*>(mapping_);
+}
+
+std::size_t MappedFloatFile::size() const
+{
+    return size_;
+}
+
+} // namespace stats
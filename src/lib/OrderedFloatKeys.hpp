@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace stats
+{
+namespace detail
+{
+
+// Maps the bits of the value so their unsigned order is the numerical order:
+// negative values have every bit flipped, the rest only the sign bit. NaN
+// values sort beyond the infinity of the same sign.
+inline std::uint32_t ordered_key(const float& value)
+{
+    std::uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    const std::uint32_t mask = (0U - (bits >> 31)) | 0x80000000U;
+    return bits ^ mask;
+}
+
+inline float ordered_value(const std::uint32_t& key)
+{
+    const std::uint32_t mask = (key >> 31) != 0 ? 0x80000000U : 0xffffffffU;
+    const std::uint32_t bits = key ^ mask;
+    float value              = 0.F;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace detail
+} // namespace stats
@@ -0,0 +1,154 @@
+#include "stats/P2QuantileEstimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace stats
+{
+
+P2QuantileEstimator::P2QuantileEstimator(const std::vector<float>& probabilities)
+    : probabilities_(probabilities)
+    , count_(0)
+{
+    std::sort(probabilities_.begin(), probabilities_.end());
+    probabilities_.erase(std::unique(probabilities_.begin(), probabilities_.end()),
+                         probabilities_.end());
+
+    // Markers sit at the minimum, at each probability, half way between
+    // neighbouring probabilities, and at the maximum.
+    increments_.push_back(0.0);
+    double previous = 0.0;
+    for (const float& probability : probabilities_)
+    {
+        increments_.push_back((previous + probability) / 2.0);
+        increments_.push_back(probability);
+        previous = probability;
+    }
+    increments_.push_back((previous + 1.0) / 2.0);
+    increments_.push_back(1.0);
+
+    const std::size_t markers = increments_.size();
+    heights_.reserve(markers);
+    positions_.resize(markers);
+    desired_positions_.resize(markers);
+    for (std::size_t i = 0; i < markers; ++i)
+    {
+        positions_[i]         = static_cast<double>(i);
+        desired_positions_[i] = static_cast<double>(markers - 1) * increments_[i];
+    }
+}
+
+void P2QuantileEstimator::add(const float& value)
+{
+    ++count_;
+
+    const std::size_t markers = increments_.size();
+    const double height       = static_cast<double>(value);
+
+    // collect the first values exactly
+    if (heights_.size() < markers)
+    {
+        heights_.insert(std::upper_bound(heights_.begin(), heights_.end(), height), height);
+        return;
+    }
+
+    // find the cell holding the value, extending the extreme markers
+    std::size_t cell = 0;
+    if (height < heights_.front())
+    {
+        heights_.front() = height;
+    }
+    else if (height >= heights_.back())
+    {
+        heights_.back() = height;
+        cell            = markers - 2;
+    }
+    else
+    {
+        cell = static_cast<std::size_t>(
+            std::upper_bound(heights_.begin(), heights_.end(), height) - heights_.begin() - 1);
+    }
+
+    for (std::size_t i = cell + 1; i < markers; ++i)
+    {
+        positions_[i] += 1.0;
+    }
+    for (std::size_t i = 0; i < markers; ++i)
+    {
+        desired_positions_[i] += increments_[i];
+    }
+
+    for (std::size_t i = 1; i + 1 < markers; ++i)
+    {
+        adjust(i);
+    }
+}
+
+void P2QuantileEstimator::adjust(std::size_t marker)
+{
+    const double offset = desired_positions_[marker] - positions_[marker];
+    const double below  = positions_[marker - 1] - positions_[marker];
+    const double above  = positions_[marker + 1] - positions_[marker];
+    if (!((offset >= 1.0 && above > 1.0) || (offset <= -1.0 && below < -1.0)))
+    {
+        return;
+    }
+
+    const double step   = offset > 0.0 ? 1.0 : -1.0;
+    const double q_prev = heights_[marker - 1];
+    const double q      = heights_[marker];
+    const double q_next = heights_[marker + 1];
+
+    // piecewise-parabolic prediction, falling back to linear when it leaves
+    // the neighbouring markers' range
+    const double parabolic =
+        q + step / (above - below) *
+                ((step - below) * (q_next - q) / above + (above - step) * (q - q_prev) / -below);
+    if (q_prev < parabolic && parabolic < q_next)
+    {
+        heights_[marker] = parabolic;
+    }
+    else
+    {
+        const double neighbour = step > 0.0 ? q_next : q_prev;
+        const double distance  = step > 0.0 ? above : below;
+        heights_[marker]       = q + step * (neighbour - q) / distance;
+    }
+    positions_[marker] += step;
+}
+
+std::size_t P2QuantileEstimator::count() const
+{
+    return count_;
+}
+
+float P2QuantileEstimator::quantile(const float& probability) const
+{
+    auto found = std::find(probabilities_.begin(), probabilities_.end(), probability);
+    if (count_ == 0 || found == probabilities_.end())
+    {
+        return stats::undefined();
+    }
+
+    if (count_ <= increments_.size())
+    {
+        // exact, interpolating between the sorted values
+        const double rank      = probability * static_cast<double>(count_ - 1);
+        const std::size_t low  = static_cast<std::size_t>(std::floor(rank));
+        const std::size_t high = std::min(low + 1, count_ - 1);
+        const double fraction  = rank - static_cast<double>(low);
+        return static_cast<float>(heights_[low] + fraction * (heights_[high] - heights_[low]));
+    }
+
+    const std::size_t marker = 2 * static_cast<std::size_t>(found - probabilities_.begin()) + 2;
+    return static_cast<float>(heights_[marker]);
+}
+
+float P2QuantileEstimator::median() const
+{
+    return quantile(0.5F);
+}
+
+} // namespace stats
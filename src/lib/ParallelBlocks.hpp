@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace stats
+{
+namespace detail
+{
+
+// Splits the range 0 to number_of_values in to one block per thread, like
+// parallel_statistics::run(), and calls work(thread, begin, end) for each
+// block. The last block, with the remainder, runs in this thread.
+template <typename WorkT>
+void run_in_blocks(std::size_t number_of_values, std::size_t number_of_threads, WorkT work)
+{
+    number_of_threads = number_of_threads == 0 ? 1 : number_of_threads;
+
+    std::vector<std::thread> spawned_threads(number_of_threads - 1);
+
+    const std::size_t block_size = number_of_values / number_of_threads;
+    for (std::size_t i = 0; i < spawned_threads.size(); ++i)
+    {
+        spawned_threads[i] = std::thread(work, i, i * block_size, (i + 1) * block_size);
+    }
+
+    work(number_of_threads - 1, spawned_threads.size() * block_size, number_of_values);
+
+    for (auto& spawned_thread : spawned_threads)
+    {
+        spawned_thread.join();
+    }
+}
+
+} // namespace detail
+} // namespace stats
@@ -0,0 +1,94 @@
+#include "stats/RangeStatisticsIndex.hpp"
+
+#include <algorithm>
+
+#include "ParallelBlocks.hpp"
+#include "stats/StatisticsUtilities.hpp"
+
+namespace stats
+{
+
+RangeStatisticsIndex::RangeStatisticsIndex(const float* values, std::size_t number_of_values,
+                                           std::size_t block_size, std::size_t number_of_threads)
+    : values_(values)
+    , number_of_values_(number_of_values)
+    , block_size_(std::max<std::size_t>(block_size, 1))
+    , number_of_blocks_((number_of_values + block_size_ - 1) / block_size_)
+    , tree_(2 * number_of_blocks_)
+{
+    // the blocks are the leaves, from tree_[number_of_blocks_] on
+    number_of_threads = number_of_threads == 0 ? stats::number_of_threads_hint()
+                                               : number_of_threads;
+    number_of_threads = std::max<std::size_t>(1, std::min(number_of_threads, number_of_blocks_));
+    detail::run_in_blocks(number_of_blocks_, number_of_threads,
+                          [&](std::size_t, std::size_t begin, std::size_t end)
+                          {
+                              for (std::size_t block = begin; block < end; ++block)
+                              {
+                                  const std::size_t first = block * block_size_;
+                                  const std::size_t size =
+                                      std::min(block_size_, number_of_values_ - first);
+                                  tree_[number_of_blocks_ + block].add(values_ + first, size);
+                              }
+                          });
+
+    for (std::size_t node = number_of_blocks_; node-- > 1;)
+    {
+        tree_[node] = tree_[2 * node] + tree_[2 * node + 1];
+    }
+}
+
+StatisticsAccumulator RangeStatisticsIndex::statistics(std::size_t begin, std::size_t end) const
+{
+    end   = std::min(end, number_of_values_);
+    begin = std::min(begin, end);
+
+    StatisticsAccumulator combined;
+
+    // the whole blocks in the range
+    const std::size_t first_block = (begin + block_size_ - 1) / block_size_;
+    const std::size_t last_block  = end / block_size_;
+    if (first_block >= last_block)
+    {
+        combined.add(values_ + begin, end - begin);
+        return combined;
+    }
+
+    combined.add(values_ + begin, first_block * block_size_ - begin);
+    combined.add(values_ + last_block * block_size_, end - last_block * block_size_);
+
+    std::size_t left  = first_block + number_of_blocks_;
+    std::size_t right = last_block + number_of_blocks_;
+    while (left < right)
+    {
+        if ((left & 1U) != 0)
+        {
+            combined += tree_[left++];
+        }
+        if ((right & 1U) != 0)
+        {
+            combined += tree_[--right];
+        }
+        left /= 2;
+        right /= 2;
+    }
+
+    return combined;
+}
+
+std::size_t RangeStatisticsIndex::size() const
+{
+    return number_of_values_;
+}
+
+std::size_t RangeStatisticsIndex::block_size() const
+{
+    return block_size_;
+}
+
+std::size_t RangeStatisticsIndex::number_of_blocks() const
+{
+    return number_of_blocks_;
+}
+
+} // namespace stats
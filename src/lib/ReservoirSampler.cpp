@@ -0,0 +1,192 @@
+#include "stats/ReservoirSampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace // unnamed namespace
+{
+
+// Adapts the sampler's generator for the standard distributions.
+class Generator
+{
+  private:
+    std::uint64_t& state_;
+
+  public:
+    using result_type = std::uint64_t;
+
+    explicit Generator(std::uint64_t& state)
+        : state_(state)
+    {
+    }
+
+    static constexpr result_type min()
+    {
+        return 1;
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()()
+    {
+        // xorshift64
+        state_ ^= state_ << 13U;
+        state_ ^= state_ >> 7U;
+        state_ ^= state_ << 17U;
+        return state_;
+    }
+};
+
+} // unnamed namespace
+
+namespace stats
+{
+
+ReservoirSampler::ReservoirSampler(std::size_t capacity, std::uint64_t seed)
+    : capacity_(std::max<std::size_t>(capacity, 1))
+    , count_(0)
+    , threshold_(0.0)
+    , next_(0)
+    , random_state_(seed == 0 ? 1 : seed)
+{
+    sample_.reserve(capacity_);
+}
+
+std::uint64_t ReservoirSampler::random()
+{
+    return Generator(random_state_)();
+}
+
+double ReservoirSampler::uniform()
+{
+    // in (0, 1), never 0, so its logarithm is finite
+    return (static_cast<double>(random() >> 11U) + 0.5) / 9007199254740992.0;
+}
+
+std::size_t ReservoirSampler::uniform_index(std::size_t size)
+{
+    return static_cast<std::size_t>(uniform() * static_cast<double>(size));
+}
+
+void ReservoirSampler::start_skipping(double threshold)
+{
+    threshold_ = threshold;
+    skip();
+}
+
+void ReservoirSampler::skip()
+{
+    // the gap to the next value with a key below the threshold is geometric
+    const double gap = floor(log(uniform()) / log1p(-threshold_));
+    next_ = gap < 1.0e18 ? count_ + static_cast<std::uint64_t>(gap) + 1
+                         : std::numeric_limits<std::uint64_t>::max();
+}
+
+void ReservoirSampler::add(const float& value)
+{
+    add(&value, 1);
+}
+
+void ReservoirSampler::add(const float* values, std::size_t number_of_values)
+{
+    const std::uint64_t first = count_;
+    const std::uint64_t end   = count_ + number_of_values;
+
+    // fill the sample
+    while (sample_.size() < capacity_ && count_ < end)
+    {
+        sample_.push_back(values[count_ - first]);
+        ++count_;
+        if (sample_.size() == capacity_)
+        {
+            start_skipping(exp(log(uniform()) / static_cast<double>(capacity_)));
+        }
+    }
+
+    // jump from one replacement to the next
+    while (sample_.size() == capacity_ && next_ <= end)
+    {
+        count_                            = next_;
+        sample_[uniform_index(capacity_)] = values[count_ - 1 - first];
+        threshold_ *= exp(log(uniform()) / static_cast<double>(capacity_));
+        skip();
+    }
+    count_ = end;
+}
+
+std::uint64_t ReservoirSampler::count() const
+{
+    return count_;
+}
+
+std::size_t ReservoirSampler::capacity() const
+{
+    return capacity_;
+}
+
+const std::vector<float>& ReservoirSampler::sample() const
+{
+    return sample_;
+}
+
+ReservoirSampler ReservoirSampler::operator+(const ReservoirSampler& that) const
+{
+    ReservoirSampler combined = *this;
+    combined.random_state_ ^= that.random_state_ * 0x9e3779b97f4a7c15ULL;
+    combined.random_state_ = combined.random_state_ == 0 ? 1 : combined.random_state_;
+    combined.count_        = this->count_ + that.count_;
+    combined.sample_.clear();
+
+    // Draw the combined sample from the two streams without replacement,
+    // taking each value from a random remaining place in either sample. A
+    // smaller sample can run out when the capacities differ.
+    std::vector<float> these     = this->sample_;
+    std::vector<float> those     = that.sample_;
+    std::uint64_t this_remaining = this->count_;
+    std::uint64_t that_remaining = that.count_;
+
+    const std::uint64_t size = std::min<std::uint64_t>(capacity_, combined.count_);
+    while (combined.sample_.size() < size)
+    {
+        const double from_this = static_cast<double>(this_remaining) /
+                                 static_cast<double>(this_remaining + that_remaining);
+        const bool take_this =
+            those.empty() || (!these.empty() && combined.uniform() < from_this);
+
+        std::vector<float>& source = take_this ? these : those;
+        --(take_this ? this_remaining : that_remaining);
+
+        const std::size_t i = combined.uniform_index(source.size());
+        combined.sample_.push_back(source[i]);
+        source[i] = source.back();
+        source.pop_back();
+    }
+
+    // The largest kept key of a uniform sample of capacity from count values
+    // has the Beta(capacity, count - capacity + 1) distribution.
+    if (combined.sample_.size() == capacity_)
+    {
+        Generator generator(combined.random_state_);
+        std::gamma_distribution<double> kept(static_cast<double>(capacity_));
+        std::gamma_distribution<double> passed(static_cast<double>(combined.count_ - capacity_) +
+                                               1.0);
+        const double x = kept(generator);
+        const double y = passed(generator);
+        combined.start_skipping(x / (x + y));
+    }
+    return combined;
+}
+
+ReservoirSampler& ReservoirSampler::operator+=(const ReservoirSampler& rhs)
+{
+    ReservoirSampler combined = *this + rhs;
+    *this                     = combined;
+    return *this;
+}
+
+} // namespace stats
@@ -0,0 +1,118 @@
+#include "stats/RevisableStatisticsAccumulator.hpp"
+
+#include <cmath>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace stats
+{
+
+RevisableStatisticsAccumulator::RevisableStatisticsAccumulator(bool track_extremes)
+    : track_extremes_(track_extremes)
+{
+}
+
+void RevisableStatisticsAccumulator::add(const float& value)
+{
+    // NaN has no place in the ordered companion
+    if (track_extremes_ && !std::isnan(value))
+    {
+        ++values_[value];
+    }
+    moments_.add(value);
+}
+
+bool RevisableStatisticsAccumulator::remove(const float& value)
+{
+    if (moments_.count() == 0)
+    {
+        return false;
+    }
+
+    if (track_extremes_ && !std::isnan(value))
+    {
+        const auto found = values_.find(value);
+        if (found == values_.end())
+        {
+            return false;
+        }
+        if (--found->second == 0)
+        {
+            values_.erase(found);
+        }
+    }
+    moments_.remove(value);
+    return true;
+}
+
+bool RevisableStatisticsAccumulator::replace(const float& old_value, const float& new_value)
+{
+    if (!remove(old_value))
+    {
+        return false;
+    }
+    add(new_value);
+    return true;
+}
+
+bool RevisableStatisticsAccumulator::tracks_extremes() const
+{
+    return track_extremes_;
+}
+
+std::size_t RevisableStatisticsAccumulator::count() const
+{
+    return moments_.count();
+}
+
+float RevisableStatisticsAccumulator::minimum() const
+{
+    if (values_.empty())
+    {
+        return stats::undefined();
+    }
+
+    return values_.begin()->first;
+}
+
+float RevisableStatisticsAccumulator::maximum() const
+{
+    if (values_.empty())
+    {
+        return stats::undefined();
+    }
+
+    return values_.rbegin()->first;
+}
+
+float RevisableStatisticsAccumulator::mean() const
+{
+    return moments_.mean();
+}
+
+float RevisableStatisticsAccumulator::absolute_mean() const
+{
+    return moments_.absolute_mean();
+}
+
+float RevisableStatisticsAccumulator::quadratic_mean() const
+{
+    return moments_.quadratic_mean();
+}
+
+float RevisableStatisticsAccumulator::standard_deviation() const
+{
+    return moments_.standard_deviation();
+}
+
+float RevisableStatisticsAccumulator::skewness() const
+{
+    return moments_.skewness();
+}
+
+float RevisableStatisticsAccumulator::kurtosis() const
+{
+    return moments_.kurtosis();
+}
+
+} // namespace stats
@@ -0,0 +1,175 @@
+#include "stats/SlidingWindowAccumulator.hpp"
+
+#include <algorithm>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace stats
+{
+
+SlidingWindowAccumulator::SlidingWindowAccumulator(std::size_t window_size)
+    : window_size_(std::max<std::size_t>(window_size, 1))
+    , ring_(window_size_)
+    , added_(0)
+    , removals_(0)
+    , minima_(window_size_)
+    , maxima_(window_size_)
+    , minima_front_(0)
+    , minima_size_(0)
+    , maxima_front_(0)
+    , maxima_size_(0)
+{
+}
+
+float SlidingWindowAccumulator::value(const std::uint64_t& position) const
+{
+    return ring_[position % window_size_];
+}
+
+void SlidingWindowAccumulator::recompute()
+{
+    const std::size_t count = moments_.count();
+    moments_                = StatisticsAccumulator();
+    for (std::uint64_t position = added_ - count; position < added_; ++position)
+    {
+        moments_.add(value(position));
+    }
+    removals_ = 0;
+}
+
+void SlidingWindowAccumulator::add(const float& value)
+{
+    if (moments_.count() == window_size_)
+    {
+        moments_.remove(ring_[added_ % window_size_]);
+        ++removals_;
+    }
+    ring_[added_ % window_size_] = value;
+    moments_.add(value);
+    const std::uint64_t position = added_++;
+
+    // Drop the candidates leaving the window from the fronts, and the ones the
+    // new value beats from the backs. What remains is monotonic, so the
+    // fronts are the extremes.
+    const std::uint64_t oldest = added_ - moments_.count();
+    while (minima_size_ > 0 && minima_[minima_front_] < oldest)
+    {
+        minima_front_ = (minima_front_ + 1) % window_size_;
+        --minima_size_;
+    }
+    while (minima_size_ > 0 &&
+           this->value(minima_[(minima_front_ + minima_size_ - 1) % window_size_]) >= value)
+    {
+        --minima_size_;
+    }
+    minima_[(minima_front_ + minima_size_++) % window_size_] = position;
+
+    while (maxima_size_ > 0 && maxima_[maxima_front_] < oldest)
+    {
+        maxima_front_ = (maxima_front_ + 1) % window_size_;
+        --maxima_size_;
+    }
+    while (maxima_size_ > 0 &&
+           this->value(maxima_[(maxima_front_ + maxima_size_ - 1) % window_size_]) <= value)
+    {
+        --maxima_size_;
+    }
+    maxima_[(maxima_front_ + maxima_size_++) % window_size_] = position;
+
+    // removal rounding must not invent spread in a constant window either
+    if (removals_ >= window_size_ ||
+        (minimum() == maximum() && moments_.standard_deviation() > 0.F))
+    {
+        recompute();
+    }
+}
+
+void SlidingWindowAccumulator::add(const float* values, std::size_t number_of_values)
+{
+    // only the last window_size() values stay
+    const std::size_t skipped = number_of_values - std::min(number_of_values, window_size_);
+    if (skipped > 0)
+    {
+        added_ += skipped;
+        moments_     = StatisticsAccumulator();
+        minima_size_ = 0;
+        maxima_size_ = 0;
+        removals_    = 0;
+    }
+    for (std::size_t i = skipped; i < number_of_values; ++i)
+    {
+        add(values[i]);
+    }
+}
+
+std::size_t SlidingWindowAccumulator::window_size() const
+{
+    return window_size_;
+}
+
+std::size_t SlidingWindowAccumulator::count() const
+{
+    return moments_.count();
+}
+
+float SlidingWindowAccumulator::minimum() const
+{
+    if (moments_.count() == 0)
+    {
+        return stats::undefined();
+    }
+
+    return value(minima_[minima_front_]);
+}
+
+float SlidingWindowAccumulator::maximum() const
+{
+    if (moments_.count() == 0)
+    {
+        return stats::undefined();
+    }
+
+    return value(maxima_[maxima_front_]);
+}
+
+float SlidingWindowAccumulator::mean() const
+{
+    return moments_.mean();
+}
+
+float SlidingWindowAccumulator::absolute_mean() const
+{
+    return moments_.absolute_mean();
+}
+
+float SlidingWindowAccumulator::quadratic_mean() const
+{
+    return moments_.quadratic_mean();
+}
+
+float SlidingWindowAccumulator::standard_deviation() const
+{
+    return moments_.standard_deviation();
+}
+
+float SlidingWindowAccumulator::skewness() const
+{
+    return moments_.skewness();
+}
+
+float SlidingWindowAccumulator::kurtosis() const
+{
+    return moments_.kurtosis();
+}
+
+StatisticsAccumulator SlidingWindowAccumulator::statistics() const
+{
+    StatisticsAccumulator statistics;
+    for (std::uint64_t position = added_ - moments_.count(); position < added_; ++position)
+    {
+        statistics.add(value(position));
+    }
+    return statistics;
+}
+
+} // namespace stats
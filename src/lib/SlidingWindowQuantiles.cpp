@@ -0,0 +1,221 @@
+#include "stats/SlidingWindowQuantiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "OrderedFloatKeys.hpp"
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+const std::uint32_t kHead = 0;
+const std::uint32_t kEnd  = 1;
+
+// The most levels the window needs, at half the nodes per level.
+const std::size_t kMaximumLevels = 32;
+
+} // unnamed namespace
+
+namespace stats
+{
+
+SlidingWindowQuantiles::SlidingWindowQuantiles(std::size_t window_size)
+    : window_size_(std::max<std::size_t>(window_size, 1))
+    , ring_(window_size_)
+    , added_(0)
+    , levels_(1)
+    , random_state_(2463534242U)
+{
+    while (levels_ < kMaximumLevels && (std::size_t(1) << levels_) < window_size_)
+    {
+        ++levels_;
+    }
+
+    // The end has no links, and the head has every level.
+    const std::size_t number_of_nodes = window_size_ + 2;
+    keys_.resize(number_of_nodes);
+    heights_.resize(number_of_nodes);
+    first_link_.resize(number_of_nodes);
+    heights_[kHead] = static_cast<std::uint8_t>(levels_);
+    heights_[kEnd]  = 0;
+
+    std::size_t number_of_links = 0;
+    for (std::size_t node = 0; node < number_of_nodes; ++node)
+    {
+        if (node > kEnd)
+        {
+            heights_[node] = static_cast<std::uint8_t>(random_height());
+        }
+        first_link_[node] = number_of_links;
+        number_of_links += heights_[node];
+    }
+    next_.resize(number_of_links, kEnd);
+    widths_.resize(number_of_links, 1);
+
+    for (std::size_t node = number_of_nodes; node-- > 2;)
+    {
+        free_nodes_.push_back(static_cast<std::uint32_t>(node));
+    }
+}
+
+std::size_t SlidingWindowQuantiles::link(const std::uint32_t& node,
+                                         const std::size_t& level) const
+{
+    return first_link_[node] + level;
+}
+
+std::size_t SlidingWindowQuantiles::random_height()
+{
+    // xorshift32, with each further level half as likely
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    const std::uint32_t cap = std::uint32_t(1) << (levels_ - 1);
+    return 1 + static_cast<std::size_t>(__builtin_ctz(random_state_ | cap));
+}
+
+void SlidingWindowQuantiles::insert(const std::uint32_t& key)
+{
+    // find the last node before the key on each level, and its rank
+    std::uint32_t chain[kMaximumLevels];
+    std::size_t chain_rank[kMaximumLevels];
+    std::uint32_t node = kHead;
+    std::size_t rank   = 0;
+    for (std::size_t level = levels_; level-- > 0;)
+    {
+        while (next_[link(node, level)] != kEnd && keys_[next_[link(node, level)]] <= key)
+        {
+            rank += widths_[link(node, level)];
+            node = next_[link(node, level)];
+        }
+        chain[level]      = node;
+        chain_rank[level] = rank;
+    }
+
+    const std::uint32_t inserted = free_nodes_.back();
+    free_nodes_.pop_back();
+    const std::size_t height = heights_[inserted];
+    keys_[inserted]          = key;
+
+    for (std::size_t level = 0; level < height; ++level)
+    {
+        const std::size_t before  = link(chain[level], level);
+        const std::size_t skipped = rank - chain_rank[level];
+
+        next_[link(inserted, level)]   = next_[before];
+        widths_[link(inserted, level)] = static_cast<std::uint32_t>(widths_[before] - skipped);
+        next_[before]                  = inserted;
+        widths_[before]                = static_cast<std::uint32_t>(skipped + 1);
+    }
+    for (std::size_t level = height; level < levels_; ++level)
+    {
+        ++widths_[link(chain[level], level)];
+    }
+}
+
+void SlidingWindowQuantiles::erase(const std::uint32_t& key)
+{
+    // find the last node before the first node with the key, on each level
+    std::uint32_t chain[kMaximumLevels];
+    std::uint32_t node = kHead;
+    for (std::size_t level = levels_; level-- > 0;)
+    {
+        while (next_[link(node, level)] != kEnd && keys_[next_[link(node, level)]] < key)
+        {
+            node = next_[link(node, level)];
+        }
+        chain[level] = node;
+    }
+
+    // any node with the key will do, and this one follows every chain node
+    const std::uint32_t erased = next_[link(chain[0], 0)];
+    const std::size_t height   = heights_[erased];
+    for (std::size_t level = 0; level < height; ++level)
+    {
+        const std::size_t before = link(chain[level], level);
+        widths_[before] += widths_[link(erased, level)] - 1;
+        next_[before] = next_[link(erased, level)];
+    }
+    for (std::size_t level = height; level < levels_; ++level)
+    {
+        --widths_[link(chain[level], level)];
+    }
+
+    free_nodes_.push_back(erased);
+}
+
+float SlidingWindowQuantiles::value_at(std::size_t rank) const
+{
+    // ranks count from 1 at the first value after the head
+    ++rank;
+    std::uint32_t node = kHead;
+    for (std::size_t level = levels_; level-- > 0;)
+    {
+        while (next_[link(node, level)] != kEnd && widths_[link(node, level)] <= rank)
+        {
+            rank -= widths_[link(node, level)];
+            node = next_[link(node, level)];
+        }
+    }
+    return detail::ordered_value(keys_[node]);
+}
+
+void SlidingWindowQuantiles::add(const float& value)
+{
+    float& slot = ring_[added_ % window_size_];
+    if (added_ >= window_size_)
+    {
+        erase(detail::ordered_key(slot));
+    }
+    slot = value;
+    insert(detail::ordered_key(value));
+    ++added_;
+}
+
+void SlidingWindowQuantiles::add(const float* values, std::size_t number_of_values)
+{
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+        add(values[i]);
+    }
+}
+
+std::size_t SlidingWindowQuantiles::window_size() const
+{
+    return window_size_;
+}
+
+std::size_t SlidingWindowQuantiles::count() const
+{
+    return static_cast<std::size_t>(std::min<std::uint64_t>(added_, window_size_));
+}
+
+float SlidingWindowQuantiles::quantile(const double& probability) const
+{
+    const std::size_t number_of_values = count();
+    if (number_of_values == 0 || std::isnan(probability))
+    {
+        return stats::undefined();
+    }
+
+    const double position = std::min(std::max(probability, 0.0), 1.0) *
+                            static_cast<double>(number_of_values - 1);
+    const std::size_t below = static_cast<std::size_t>(position);
+    const double fraction   = position - static_cast<double>(below);
+
+    const double lower = value_at(below);
+    if (fraction == 0.0)
+    {
+        return static_cast<float>(lower);
+    }
+    const double upper = value_at(below + 1);
+    return static_cast<float>(lower + fraction * (upper - lower));
+}
+
+float SlidingWindowQuantiles::median() const
+{
+    return quantile(0.5);
+}
+
+} // namespace stats
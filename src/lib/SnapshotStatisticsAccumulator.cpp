@@ -0,0 +1,63 @@
+#include "stats/SnapshotStatisticsAccumulator.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace stats
+{
+
+static_assert(std::is_trivially_copyable<StatisticsAccumulator>::value,
+              "the published statistics are copied word by word");
+
+SnapshotStatisticsAccumulator::SnapshotStatisticsAccumulator()
+    : sequence_(0)
+{
+    publish();
+}
+
+void SnapshotStatisticsAccumulator::publish()
+{
+    std::array<std::uint64_t, kWords> words{};
+    memcpy(words.data(), &statistics_, sizeof(statistics_));
+
+    const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < kWords; ++i)
+    {
+        published_[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+void SnapshotStatisticsAccumulator::add(const float& value)
+{
+    statistics_.add(value);
+    publish();
+}
+
+StatisticsAccumulator SnapshotStatisticsAccumulator::snapshot() const
+{
+    std::array<std::uint64_t, kWords> words{};
+
+    std::uint64_t before = 0;
+    std::uint64_t after  = 0;
+    do
+    {
+        before = sequence_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < kWords; ++i)
+        {
+            words[i] = published_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1U) != 0 || before != after);
+
+    StatisticsAccumulator statistics;
+    memcpy(static_cast<void*>(&statistics), words.data(), sizeof(statistics));
+    return statistics;
+}
+
+} // namespace stats
@@ -5,6 +5,19 @@
 #include "stats/StatisticsAccumulator.hpp"
 #include "stats/StatisticsUtilities.hpp"
 
+namespace // unnamed namespace
+{
+
+// Values per block in the bulk update. Small enough to stay in the L1 cache
+// between the two passes over the block.
+const std::size_t kBlockSize = 1024;
+
+// Independent partial sums per pass, letting the compiler vectorize the loops
+// without re-associating floating point additions.
+const std::size_t kLanes = 8;
+
+} // unnamed namespace
+
 namespace stats
 {
 
@@ -17,6 +30,7 @@ StatisticsAccumulator::StatisticsAccumulator()
     , moment2_(0.0)
     , moment3_(0.0)
     , moment4_(0.0)
+    , extrema_known_(true)
 {
 }
 
@@ -41,6 +55,143 @@ void StatisticsAccumulator::add(const float& value)
     moment2_ += term1;
 }
 
+void StatisticsAccumulator::remove(const float& value)
+{
+    if (count_ <= 1)
+    {
+        *this = StatisticsAccumulator();
+        return;
+    }
+
+    extrema_known_ = false;
+
+    // Recover the mean before the value was added, then the delta terms
+    // add() used, and undo each update in the reverse order.
+    const double dVal     = static_cast<double>(value);
+    const double nvals    = static_cast<double>(count_);
+    const double previous = (nvals * moment1_ - dVal) / (nvals - 1);
+    const double delta    = dVal - previous;
+    const double delta_n  = delta / nvals;
+    const double delta_n2 = delta_n * delta_n;
+    const double term1    = delta * delta_n * (nvals - 1);
+    moment2_ -= term1;
+    moment3_ -= term1 * delta_n * (nvals - 2) - 3.0 * delta_n * moment2_;
+    moment4_ -= term1 * delta_n2 * (nvals * nvals - 3 * nvals + 3) + 6.0 * delta_n2 * moment2_ -
+                4.0 * delta_n * moment3_;
+    abs_moment1_ = (nvals * abs_moment1_ - fabs(dVal)) / (nvals - 1);
+    moment1_     = previous;
+
+    --count_;
+
+    // rounding can leave tiny negative sums of squares
+    moment2_ = std::max(0.0, moment2_);
+    moment4_ = std::max(0.0, moment4_);
+}
+
+void StatisticsAccumulator::add(const float* values, std::size_t number_of_values)
+{
+    for (std::size_t first = 0; first < number_of_values; first += kBlockSize)
+    {
+        const std::size_t block_size = std::min(kBlockSize, number_of_values - first);
+        *this += block(values + first, block_size);
+    }
+}
+
+StatisticsAccumulator StatisticsAccumulator::block(const float* values,
+                                                   std::size_t number_of_values)
+{
+    StatisticsAccumulator statistics;
+    if (number_of_values == 0)
+    {
+        return statistics;
+    }
+
+    const std::size_t vector_end = number_of_values - number_of_values % kLanes;
+
+    // first pass: extremes, sum and absolute sum
+
+    float minimum[kLanes], maximum[kLanes];
+    double sum[kLanes], abs_sum[kLanes];
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        minimum[lane] = std::numeric_limits<float>::max();
+        maximum[lane] = -std::numeric_limits<float>::max();
+        sum[lane]     = 0.0;
+        abs_sum[lane] = 0.0;
+    }
+    for (std::size_t i = 0; i < vector_end; i += kLanes)
+    {
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            const float value = values[i + lane];
+            minimum[lane]     = std::min(value, minimum[lane]);
+            maximum[lane]     = std::max(value, maximum[lane]);
+            sum[lane] += static_cast<double>(value);
+            abs_sum[lane] += static_cast<double>(fabs(value));
+        }
+    }
+    for (std::size_t i = vector_end; i < number_of_values; ++i)
+    {
+        minimum[0] = std::min(values[i], minimum[0]);
+        maximum[0] = std::max(values[i], maximum[0]);
+        sum[0] += static_cast<double>(values[i]);
+        abs_sum[0] += static_cast<double>(fabs(values[i]));
+    }
+
+    const double nvals = static_cast<double>(number_of_values);
+    double total       = 0.0;
+    double abs_total   = 0.0;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        statistics.minimum_ = std::min(minimum[lane], statistics.minimum_);
+        statistics.maximum_ = std::max(maximum[lane], statistics.maximum_);
+        total += sum[lane];
+        abs_total += abs_sum[lane];
+    }
+    const double mean = total / nvals;
+
+    // second pass: central moments about the block mean
+
+    double m2[kLanes], m3[kLanes], m4[kLanes];
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        m2[lane] = 0.0;
+        m3[lane] = 0.0;
+        m4[lane] = 0.0;
+    }
+    for (std::size_t i = 0; i < vector_end; i += kLanes)
+    {
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+            const double delta  = static_cast<double>(values[i + lane]) - mean;
+            const double delta2 = delta * delta;
+            m2[lane] += delta2;
+            m3[lane] += delta2 * delta;
+            m4[lane] += delta2 * delta2;
+        }
+    }
+    for (std::size_t i = vector_end; i < number_of_values; ++i)
+    {
+        const double delta  = static_cast<double>(values[i]) - mean;
+        const double delta2 = delta * delta;
+        m2[0] += delta2;
+        m3[0] += delta2 * delta;
+        m4[0] += delta2 * delta2;
+    }
+
+    statistics.count_       = number_of_values;
+    statistics.moment1_     = mean;
+    statistics.abs_moment1_ = abs_total / nvals;
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+    {
+        statistics.moment2_ += m2[lane];
+        statistics.moment3_ += m3[lane];
+        statistics.moment4_ += m4[lane];
+    }
+
+    return statistics;
+}
+
 size_t StatisticsAccumulator::count() const
 {
     return count_;
@@ -48,7 +199,7 @@ size_t StatisticsAccumulator::count() const
 
 float StatisticsAccumulator::minimum() const
 {
-    if (count_ == 0)
+    if (count_ == 0 || !extrema_known_)
     {
         return stats::undefined();
     }
@@ -58,7 +209,7 @@ float StatisticsAccumulator::minimum() const
 
 float StatisticsAccumulator::maximum() const
 {
-    if (count_ == 0)
+    if (count_ == 0 || !extrema_known_)
     {
         return stats::undefined();
     }
@@ -186,6 +337,8 @@ StatisticsAccumulator StatisticsAccumulator::operator+(const StatisticsAccumulat
     combined.minimum_ = std::min(this->minimum_, that.minimum_);
     combined.maximum_ = std::max(this->maximum_, that.maximum_);
 
+    combined.extrema_known_ = this->extrema_known_ && that.extrema_known_;
+
     combined.moment1_ = (a_n * a_m1 + b_n * b_m1) / c_n;
 
     combined.abs_moment1_ = (a_n * a_abs_m1 + b_n * b_abs_m1) / c_n;
@@ -210,4 +363,72 @@ StatisticsAccumulator& StatisticsAccumulator::operator+=(const StatisticsAccumul
     return *this;
 }
 
+StatisticsAccumulator StatisticsAccumulator::operator-(const StatisticsAccumulator& that) const
+{
+    if (that.count_ == 0)
+    {
+        return *this;
+    }
+
+    if (that.count_ >= this->count_)
+    {
+        return StatisticsAccumulator();
+    }
+
+    // Solves the operator+() formulas for a, given c = a + b.
+
+    const double a_n = static_cast<double>(this->count_ - that.count_);
+    const double b_n = static_cast<double>(that.count_);
+    const double c_n = static_cast<double>(this->count_);
+
+    const double& c_m1(this->moment1_);
+    const double& c_abs_m1(this->abs_moment1_);
+    const double& c_m2(this->moment2_);
+    const double& c_m3(this->moment3_);
+    const double& c_m4(this->moment4_);
+
+    const double& b_m1(that.moment1_);
+    const double& b_abs_m1(that.abs_moment1_);
+    const double& b_m2(that.moment2_);
+    const double& b_m3(that.moment3_);
+    const double& b_m4(that.moment4_);
+
+    StatisticsAccumulator difference;
+
+    difference.count_         = this->count_ - that.count_;
+    difference.extrema_known_ = false;
+
+    difference.moment1_ = (c_n * c_m1 - b_n * b_m1) / a_n;
+
+    difference.abs_moment1_ = (c_n * c_abs_m1 - b_n * b_abs_m1) / a_n;
+
+    const double delta  = b_m1 - difference.moment1_;
+    const double delta2 = delta * delta;
+    const double delta3 = delta * delta2;
+    const double delta4 = delta2 * delta2;
+
+    // rounding must not leave a negative sum of squares
+    const double a_m2   = std::max(0.0, c_m2 - b_m2 - delta2 * a_n * b_n / c_n);
+    difference.moment2_ = a_m2;
+
+    double a_m3 = c_m3 - b_m3 - delta3 * a_n * b_n * (a_n - b_n) / (c_n * c_n);
+    a_m3 -= 3.0 * delta * (a_n * b_m2 - b_n * a_m2) / c_n;
+    difference.moment3_ = a_m3;
+
+    double a_m4 =
+        c_m4 - b_m4 - delta4 * a_n * b_n * (a_n * a_n - a_n * b_n + b_n * b_n) / (c_n * c_n * c_n);
+    a_m4 -= 6.0 * delta2 * (a_n * a_n * b_m2 + b_n * b_n * a_m2) / (c_n * c_n) +
+            4.0 * delta * (a_n * b_m3 - b_n * a_m3) / c_n;
+    difference.moment4_ = std::max(0.0, a_m4);
+
+    return difference;
+}
+
+StatisticsAccumulator& StatisticsAccumulator::operator-=(const StatisticsAccumulator& rhs)
+{
+    StatisticsAccumulator difference = *this - rhs;
+    *this                            = difference;
+    return *this;
+}
+
 } // namespace stats
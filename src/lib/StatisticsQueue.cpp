@@ -0,0 +1,136 @@
+#include "stats/StatisticsQueue.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "stats/StatisticsAccumulator.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values handed to the accumulator per array add() in drain().
+const std::size_t kDrainBlockSize = 1024;
+
+std::size_t power_of_two_at_least(std::size_t number)
+{
+    std::size_t power = 2;
+    while (power < number)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+StatisticsQueue::StatisticsQueue(std::size_t capacity)
+    : cells_(power_of_two_at_least(capacity))
+    , mask_(cells_.size() - 1)
+    , enqueue_position_(0)
+    , dequeue_position_(0)
+    , dropped_(0)
+{
+    for (std::size_t i = 0; i < cells_.size(); ++i)
+    {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool StatisticsQueue::push(const float& value)
+{
+    return push(&value, 1) == 1;
+}
+
+std::size_t StatisticsQueue::push(const float* values, std::size_t number_of_values)
+{
+    // Read the consumer position before the producer position, so the free
+    // space computed from them is never over-estimated. Other producers may
+    // have seen a newer consumer position, so the queue can look over-full.
+    std::size_t position = 0;
+    std::size_t claimed  = 0;
+    for (;;)
+    {
+        const std::size_t dequeue_position = dequeue_position_.load(std::memory_order_acquire);
+        position = enqueue_position_.load(std::memory_order_relaxed);
+
+        const std::size_t used = position - dequeue_position;
+        const std::size_t free = used < cells_.size() ? cells_.size() - used : 0;
+        claimed                = std::min(number_of_values, free);
+        if (claimed == 0 || enqueue_position_.compare_exchange_strong(
+                                position, position + claimed, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; i < claimed; ++i)
+    {
+        Cell& cell = cells_[(position + i) & mask_];
+        cell.value = values[i];
+        cell.sequence.store(position + i + 1, std::memory_order_release);
+    }
+
+    if (claimed < number_of_values)
+    {
+        dropped_.fetch_add(number_of_values - claimed, std::memory_order_relaxed);
+    }
+
+    return claimed;
+}
+
+std::size_t StatisticsQueue::drain(StatisticsAccumulator& accumulator)
+{
+    std::array<float, kDrainBlockSize> block;
+    std::size_t block_size = 0;
+    std::size_t drained    = 0;
+
+    std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Cell& cell = cells_[position & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+        {
+            break; // empty, or the next producer has not finished writing
+        }
+
+        block[block_size++] = cell.value;
+        cell.sequence.store(position + cells_.size(), std::memory_order_release);
+        ++position;
+
+        if (block_size == block.size())
+        {
+            dequeue_position_.store(position, std::memory_order_release);
+            accumulator.add(block.data(), block_size);
+            drained += block_size;
+            block_size = 0;
+        }
+    }
+
+    dequeue_position_.store(position, std::memory_order_release);
+    accumulator.add(block.data(), block_size);
+    drained += block_size;
+
+    return drained;
+}
+
+std::size_t StatisticsQueue::capacity() const
+{
+    return cells_.size();
+}
+
+std::size_t StatisticsQueue::depth() const
+{
+    const std::size_t dequeue_position = dequeue_position_.load(std::memory_order_acquire);
+    const std::size_t enqueue_position = enqueue_position_.load(std::memory_order_relaxed);
+    return enqueue_position - dequeue_position;
+}
+
+std::uint64_t StatisticsQueue::dropped() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+} // namespace stats
@@ -0,0 +1,194 @@
+#include "stats/StatisticsRegistry.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "stats/SnapshotStatisticsAccumulator.hpp"
+
+namespace stats
+{
+
+namespace // unnamed namespace
+{
+
+// One thread's accumulators for one registry. Only the owning thread adds
+// values. The metrics container grows under the registry lock, so snapshots
+// can read it under the same lock.
+struct ThreadMetrics
+{
+    std::shared_ptr<StatisticsRegistry::State> state;
+    std::deque<SnapshotStatisticsAccumulator> metrics;
+};
+
+} // unnamed namespace
+
+struct StatisticsRegistry::State
+{
+    std::mutex mutex;
+    bool alive = true;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::size_t> ids;
+    std::vector<StatisticsAccumulator> retired;
+    std::vector<ThreadMetrics*> live;
+
+    StatisticsAccumulator combined(std::size_t metric) const
+    {
+        StatisticsAccumulator statistics = retired[metric];
+        for (const ThreadMetrics* thread_metrics : live)
+        {
+            if (metric < thread_metrics->metrics.size())
+            {
+                statistics += thread_metrics->metrics[metric].snapshot();
+            }
+        }
+        return statistics;
+    }
+
+    void retire(ThreadMetrics& thread_metrics)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t metric = 0; metric < thread_metrics.metrics.size(); ++metric)
+        {
+            retired[metric] += thread_metrics.metrics[metric].snapshot();
+        }
+        live.erase(std::find(live.begin(), live.end(), &thread_metrics));
+    }
+};
+
+namespace // unnamed namespace
+{
+
+// All of one thread's registrations, retired when the thread exits.
+struct ThreadRegistrations
+{
+    std::vector<std::unique_ptr<ThreadMetrics>> registrations;
+
+    ThreadRegistrations() = default;
+
+    ThreadRegistrations(const ThreadRegistrations&)            = delete;
+    ThreadRegistrations& operator=(const ThreadRegistrations&) = delete;
+
+    ~ThreadRegistrations()
+    {
+        for (auto& thread_metrics : registrations)
+        {
+            thread_metrics->state->retire(*thread_metrics);
+        }
+    }
+
+    ThreadMetrics& find(const std::shared_ptr<StatisticsRegistry::State>& state)
+    {
+        for (auto& thread_metrics : registrations)
+        {
+            if (thread_metrics->state == state)
+            {
+                return *thread_metrics;
+            }
+        }
+        return add(state);
+    }
+
+    ThreadMetrics& add(const std::shared_ptr<StatisticsRegistry::State>& state)
+    {
+        // forget the registrations of destroyed registries
+        for (auto it = registrations.begin(); it != registrations.end();)
+        {
+            std::unique_lock<std::mutex> lock((*it)->state->mutex);
+            if ((*it)->state->alive)
+            {
+                ++it;
+            }
+            else
+            {
+                auto& live = (*it)->state->live;
+                live.erase(std::find(live.begin(), live.end(), it->get()));
+                lock.unlock();
+                it = registrations.erase(it);
+            }
+        }
+
+        registrations.emplace_back(new ThreadMetrics{state, {}});
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->live.push_back(registrations.back().get());
+        return *registrations.back();
+    }
+};
+
+thread_local ThreadRegistrations tls_registrations;
+
+} // unnamed namespace
+
+StatisticsRegistry::StatisticsRegistry()
+    : state_(std::make_shared<State>())
+{
+}
+
+StatisticsRegistry::~StatisticsRegistry()
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->alive = false;
+}
+
+std::size_t StatisticsRegistry::metric(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+
+    auto found = state_->ids.find(name);
+    if (found != state_->ids.end())
+    {
+        return found->second;
+    }
+
+    const std::size_t id = state_->names.size();
+    state_->names.push_back(name);
+    state_->ids.emplace(name, id);
+    state_->retired.emplace_back();
+    return id;
+}
+
+void StatisticsRegistry::record(std::size_t metric, const float& value)
+{
+    ThreadMetrics& thread_metrics = tls_registrations.find(state_);
+    if (metric >= thread_metrics.metrics.size())
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        if (metric >= state_->names.size())
+        {
+            return; // not an id from metric()
+        }
+        while (metric >= thread_metrics.metrics.size())
+        {
+            thread_metrics.metrics.emplace_back();
+        }
+    }
+    thread_metrics.metrics[metric].add(value);
+}
+
+StatisticsAccumulator StatisticsRegistry::snapshot(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+
+    auto found = state_->ids.find(name);
+    if (found == state_->ids.end())
+    {
+        return StatisticsAccumulator();
+    }
+    return state_->combined(found->second);
+}
+
+std::map<std::string, StatisticsAccumulator> StatisticsRegistry::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(state_->mutex);
+
+    std::map<std::string, StatisticsAccumulator> snapshots;
+    for (std::size_t metric = 0; metric < state_->names.size(); ++metric)
+    {
+        snapshots.emplace(state_->names[metric], state_->combined(metric));
+    }
+    return snapshots;
+}
+
+} // namespace stats
@@ -1,15 +1,34 @@
 #include "stats/StatisticsReport.hpp"
 
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "StatisticsReportsHelpers.hpp"
+#include "stats/DecayedHistogram.hpp"
+#include "stats/ExponentialStatisticsAccumulator.hpp"
+#include "stats/HistogramAccumulator.hpp"
+#include "stats/LogLinearHistogram.hpp"
+#include "stats/P2QuantileEstimator.hpp"
+#include "stats/SlidingWindowAccumulator.hpp"
+#include "stats/SlidingWindowQuantiles.hpp"
 #include "stats/StatisticsAccumulator.hpp"
 #include "stats/StatisticsUtilities.hpp"
+#include "stats/TDigest.hpp"
 
-namespace stats
+namespace // unnamed namespace
 {
 
-std::string description(const stats::StatisticsAccumulator &statistics)
+// Percent and value of each percentile line in a description.
+using Percentiles = std::vector<std::pair<float, float>>;
+
+// Percentiles reported from quantile sketches.
+const std::vector<float> kReportedPercents = {90.F, 99.F, 99.9F};
+
+// Describes any statistics providing StatisticsAccumulator's accessors.
+template <typename StatisticsT>
+std::string describe(const StatisticsT &statistics, const float &median,
+                     const Percentiles &percentiles = Percentiles())
 {
     using namespace stats::detail;
 
@@ -24,12 +43,28 @@ std::string description(const stats::StatisticsAccumulator &statistics)
 
     if (statistics.count() == 1)
     {
-        oss << std::endl << label_and_value(kValueLabel, statistics.minimum());
+        oss << std::endl << label_and_value(kValueLabel, statistics.mean());
     }
     else
     {
-        oss << std::endl << label_and_value(kMinimumLabel, statistics.minimum());
-        oss << std::endl << label_and_value(kMaximumLabel, statistics.maximum());
+        // the extremes are unknown after subtraction
+        if (!stats::undefined(statistics.minimum()))
+        {
+            oss << std::endl << label_and_value(kMinimumLabel, statistics.minimum());
+            oss << std::endl << label_and_value(kMaximumLabel, statistics.maximum());
+        }
+        if (!stats::undefined(median))
+        {
+            oss << std::endl << label_and_value(kMedianLabel, median);
+        }
+        for (const auto &percentile : percentiles)
+        {
+            if (!stats::undefined(percentile.second))
+            {
+                oss << std::endl
+                    << label_and_value(percentile_label(percentile.first), percentile.second);
+            }
+        }
         oss << std::endl << label_and_value(kMeanLabel, statistics.mean());
         oss << std::endl << label_and_value(kAbsMeanLabel, statistics.absolute_mean());
         oss << std::endl << label_and_value(kRmsLabel, statistics.quadratic_mean());
@@ -47,4 +82,94 @@ std::string description(const stats::StatisticsAccumulator &statistics)
     return oss.str();
 }
 
+// Describes the statistics with the median and reported percentiles from a
+// sketch providing quantile().
+template <typename StatisticsT, typename SketchT>
+std::string describe_with_quantiles(const StatisticsT &statistics, const SketchT &sketch)
+{
+    Percentiles percentiles;
+    for (const float &percent : kReportedPercents)
+    {
+        percentiles.emplace_back(percent, sketch.quantile(percent / 100.0));
+    }
+    return describe(statistics, sketch.quantile(0.5), percentiles);
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+std::string description(const stats::StatisticsAccumulator &statistics)
+{
+    return describe(statistics, stats::undefined());
+}
+
+std::string description(const stats::StatisticsAccumulator &statistics,
+                        const stats::P2QuantileEstimator &quantiles)
+{
+    return describe(statistics, quantiles.median());
+}
+
+std::string description(const stats::StatisticsAccumulator &statistics,
+                        const stats::TDigest &digest)
+{
+    return describe_with_quantiles(statistics, digest);
+}
+
+std::string description(const stats::StatisticsAccumulator &statistics,
+                        const stats::LogLinearHistogram &histogram)
+{
+    return describe_with_quantiles(statistics, histogram);
+}
+
+std::string description(const stats::SlidingWindowAccumulator &statistics,
+                        const stats::SlidingWindowQuantiles &quantiles)
+{
+    return describe_with_quantiles(statistics, quantiles);
+}
+
+std::string description(const stats::ExponentialStatisticsAccumulator &statistics)
+{
+    return describe(statistics, stats::undefined());
+}
+
+std::string description(const stats::ExponentialStatisticsAccumulator &statistics,
+                        const stats::DecayedHistogram &histogram)
+{
+    return describe_with_quantiles(statistics, histogram);
+}
+
+std::string description(const stats::HistogramAccumulator &histogram)
+{
+    using namespace stats::detail;
+
+    std::ostringstream oss;
+    oss.precision(6);
+
+    oss << count_description(histogram.count());
+
+    if (histogram.count() == 0)
+    {
+        return oss.str();
+    }
+
+    if (histogram.underflow() > 0)
+    {
+        oss << std::endl << kUnderflowLabel << histogram.underflow();
+    }
+    for (std::size_t bin = 0; bin < histogram.number_of_bins(); ++bin)
+    {
+        oss << std::endl
+            << " [" << histogram.lower_bound(bin) << ", " << histogram.lower_bound(bin + 1)
+            << ") = " << histogram.count(bin);
+    }
+    if (histogram.overflow() > 0)
+    {
+        oss << std::endl << kOverflowLabel << histogram.overflow();
+    }
+
+    return oss.str();
+}
+
 } // namespace stats
@@ -1,5 +1,6 @@
 #include "StatisticsReportsHelpers.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace stats
@@ -37,5 +38,17 @@ std::string label_and_value(const std::string& label, const float& value)
     return oss.str();
 }
 
+std::string percentile_label(const float& percent)
+{
+    std::ostringstream oss;
+
+    oss << "P" << percent;
+
+    // pad to the width of the other labels, like " Median   = "
+    std::string label = " " + oss.str();
+    label.resize(std::max(label.size(), kMedianLabel.size() - 3), ' ');
+    return label + " = ";
+}
+
 } // namespace detail
 } // namespace stats
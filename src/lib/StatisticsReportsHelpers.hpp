@@ -12,6 +12,8 @@ std::string count_description(const std::size_t& count);
 
 std::string label_and_value(const std::string& label, const float& value);
 
+std::string percentile_label(const float& percent);
+
 const std::string kValueLabel(" Value = ");
 
 const std::string kMinimumLabel(" Minimum  = ");
@@ -24,5 +26,8 @@ const std::string kStdDevnLabel(" Std.Devn = ");
 const std::string kSkewnessLabel(" Skewness = ");
 const std::string kKurtosisLabel(" Kurtosis = ");
 
+const std::string kUnderflowLabel(" Underflow = ");
+const std::string kOverflowLabel(" Overflow  = ");
+
 } // namespace detail
 } // namespace stats
@@ -0,0 +1,188 @@
+#include "stats/StatisticsRollup.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace // unnamed namespace
+{
+
+// Rounds down for negative timestamps too.
+std::int64_t floor_divide(const std::int64_t& timestamp, const std::int64_t& width)
+{
+    const std::int64_t quotient = timestamp / width;
+    return quotient - (timestamp % width < 0 ? 1 : 0);
+}
+
+// The nodes of width times the finer nodes' width that span as much time as
+// the retained finer nodes, and at least one.
+std::int64_t retention(const std::size_t& finer_nodes, const std::size_t& width)
+{
+    return static_cast<std::int64_t>(std::max<std::size_t>((finer_nodes + width - 1) / width, 1));
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+StatisticsRollup::StatisticsRollup(std::size_t seconds, std::size_t minutes, std::size_t hours,
+                                   std::size_t days)
+    : widths_({1, 10, 60, 600, 3600, 21600, 86400})
+    , retention_({retention(seconds, 1), retention(seconds, 10), retention(minutes, 1),
+                  retention(minutes, 10), retention(hours, 1), retention(hours, 6),
+                  retention(days, 1)})
+    , newest_()
+    , pending_second_(std::numeric_limits<std::int64_t>::min())
+{
+    newest_.fill(std::numeric_limits<std::int64_t>::min());
+}
+
+bool StatisticsRollup::retained(const std::size_t& level, const std::int64_t& node) const
+{
+    return newest_[level] != std::numeric_limits<std::int64_t>::min() &&
+           node > newest_[level] - retention_[level];
+}
+
+bool StatisticsRollup::fits(const std::size_t& level, const std::int64_t& start,
+                            const std::int64_t& end) const
+{
+    const std::int64_t node = floor_divide(start, widths_[level]);
+    return node * widths_[level] == start && end - start >= widths_[level] && retained(level, node);
+}
+
+void StatisticsRollup::roll_up(const std::int64_t& second, const StatisticsAccumulator& statistics)
+{
+    for (std::size_t level = 0; level < kLevels; ++level)
+    {
+        const std::int64_t node = floor_divide(second, widths_[level]);
+        if (node > newest_[level])
+        {
+            newest_[level] = node;
+
+            // expire the nodes that have left the retention
+            auto& nodes = levels_[level];
+            nodes.erase(nodes.begin(), nodes.upper_bound(node - retention_[level]));
+        }
+        else if (!retained(level, node))
+        {
+            continue; // too old for this level, but perhaps not the coarser ones
+        }
+        levels_[level][node] += statistics;
+    }
+}
+
+void StatisticsRollup::add(const std::int64_t& timestamp, const float& value)
+{
+    if (timestamp != pending_second_)
+    {
+        if (pending_.count() > 0)
+        {
+            roll_up(pending_second_, pending_);
+        }
+        pending_second_ = timestamp;
+        pending_        = StatisticsAccumulator();
+    }
+    pending_.add(value);
+}
+
+void StatisticsRollup::add(const std::int64_t& timestamp,
+                           const StatisticsAccumulator& statistics)
+{
+    if (statistics.count() > 0)
+    {
+        roll_up(timestamp, statistics);
+    }
+}
+
+void StatisticsRollup::decompose(const std::int64_t& start, const std::int64_t& end,
+                                 std::vector<const StatisticsAccumulator*>& nodes) const
+{
+    if (pending_.count() > 0 && pending_second_ >= start && pending_second_ < end)
+    {
+        nodes.push_back(&pending_);
+    }
+
+    if (newest_[0] == std::numeric_limits<std::int64_t>::min())
+    {
+        return; // nothing rolled up yet
+    }
+
+    // Walk only the seconds some level still retains, so neither the steps
+    // nor the node boundaries run towards the int64 limits.
+    std::int64_t first = newest_[0];
+    for (std::size_t level = 0; level < kLevels; ++level)
+    {
+        first = std::min(first, (newest_[level] - retention_[level] + 1) * widths_[level]);
+    }
+    const std::int64_t last = std::min(end, newest_[0] + 1);
+
+    // Take the widest retained node starting at each step that fits in the
+    // range. The widths nest, so no other split uses fewer nodes.
+    std::int64_t second = std::max(start, first);
+    while (second < last)
+    {
+        std::size_t level = kLevels - 1;
+        while (level > 0 && !fits(level, second, last))
+        {
+            --level;
+        }
+
+        if (!fits(level, second, last))
+        {
+            // Nothing fits, so the finer levels have expired here. Skip to
+            // the next node of the finest level still retained.
+            std::size_t coarse = 1;
+            while (coarse < kLevels - 1 &&
+                   !retained(coarse, floor_divide(second, widths_[coarse])))
+            {
+                ++coarse;
+            }
+            const std::int64_t node    = floor_divide(second, widths_[coarse]);
+            const std::int64_t to_next = node * widths_[coarse] + widths_[coarse] - second;
+            second                     = last - second <= to_next ? last : second + to_next;
+            continue;
+        }
+
+        const std::int64_t node = floor_divide(second, widths_[level]);
+        const auto found        = levels_[level].find(node);
+        if (found != levels_[level].end())
+        {
+            nodes.push_back(&found->second);
+        }
+        second += widths_[level];
+    }
+}
+
+StatisticsAccumulator StatisticsRollup::range(const std::int64_t& start,
+                                              const std::int64_t& end) const
+{
+    std::vector<const StatisticsAccumulator*> nodes;
+    decompose(start, end, nodes);
+
+    StatisticsAccumulator combined;
+    for (const StatisticsAccumulator* node : nodes)
+    {
+        combined += *node;
+    }
+    return combined;
+}
+
+std::size_t StatisticsRollup::number_of_nodes(const std::int64_t& start,
+                                              const std::int64_t& end) const
+{
+    std::vector<const StatisticsAccumulator*> nodes;
+    decompose(start, end, nodes);
+    return nodes.size();
+}
+
+std::int64_t StatisticsRollup::width(const std::size_t& level) const
+{
+    return widths_[std::min(level, kLevels - 1)];
+}
+
+std::size_t StatisticsRollup::size(const std::size_t& level) const
+{
+    return levels_[std::min(level, kLevels - 1)].size();
+}
+
+} // namespace stats
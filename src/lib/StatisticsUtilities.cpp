@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <thread>
 
 namespace // unnamed namspace
 {
@@ -34,4 +35,14 @@ bool undefined(const float& value)
     return value == kUndefined;
 }
 
+std::size_t number_of_threads_hint()
+{
+    std::size_t number_of_threads = std::thread::hardware_concurrency();
+    if (number_of_threads == 0)
+    {
+        number_of_threads = 2; // set to 2, if not detected
+    }
+    return number_of_threads;
+}
+
 } // namespace stats
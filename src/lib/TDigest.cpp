@@ -0,0 +1,344 @@
+#include "stats/TDigest.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "stats/StatisticsUtilities.hpp"
+
+namespace // unnamed namespace
+{
+
+const double kPi = 3.14159265358979323846;
+
+// Compressions outside this range are clamped to it. More compression than
+// the maximum only buys memory: the buffer holds five values per unit.
+const double kMinimumCompression = 10.0;
+const double kMaximumCompression = 100000.0;
+
+// Serialization format version, the first byte of serialize()'s result.
+const unsigned char kFormatVersion = 1;
+
+// k1 scale function, and its inverse, mapping quantile to centroid index.
+double scale(const double& quantile, const double& compression)
+{
+    return compression / (2.0 * kPi) * asin(2.0 * quantile - 1.0);
+}
+
+double inverse_scale(const double& index, const double& compression)
+{
+    const double limited = std::min(index, compression / 4.0);
+    return (sin(limited * 2.0 * kPi / compression) + 1.0) / 2.0;
+}
+
+template <typename T>
+void put(std::string& bytes, const T& value)
+{
+    char raw[sizeof(T)];
+    memcpy(raw, &value, sizeof(T));
+    bytes.append(raw, sizeof(T));
+}
+
+void put_varint(std::string& bytes, std::uint64_t value)
+{
+    while (value >= 0x80U)
+    {
+        bytes.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+        value >>= 7U;
+    }
+    bytes.push_back(static_cast<char>(value));
+}
+
+template <typename T>
+bool get(const std::string& bytes, std::size_t& offset, T& value)
+{
+    if (bytes.size() - offset < sizeof(T))
+    {
+        return false;
+    }
+    memcpy(&value, bytes.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+bool get_varint(const std::string& bytes, std::size_t& offset, std::uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && offset < bytes.size(); shift += 7)
+    {
+        const auto byte = static_cast<unsigned char>(bytes[offset++]);
+        value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // unnamed namespace
+
+namespace stats
+{
+
+TDigest::TDigest(double compression)
+    : compression_(compression >= kMinimumCompression
+                       ? std::min(compression, kMaximumCompression)
+                       : kMinimumCompression)
+    , count_(0)
+    , minimum_(std::numeric_limits<float>::max())
+    , maximum_(-std::numeric_limits<float>::max())
+{
+}
+
+void TDigest::add(const float& value)
+{
+    add(&value, 1);
+}
+
+void TDigest::add(const float* values, std::size_t number_of_values)
+{
+    const std::size_t buffer_limit = static_cast<std::size_t>(5.0 * compression_);
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+        minimum_ = std::min(values[i], minimum_);
+        maximum_ = std::max(values[i], maximum_);
+        buffer_.push_back({static_cast<double>(values[i]), 1.0});
+        if (buffer_.size() >= buffer_limit)
+        {
+            compress();
+        }
+    }
+    count_ += number_of_values;
+}
+
+std::vector<TDigest::Centroid> TDigest::merged() const
+{
+    if (buffer_.empty())
+    {
+        return centroids_;
+    }
+
+    std::vector<Centroid> sorted = buffer_;
+    sorted.insert(sorted.end(), centroids_.begin(), centroids_.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+    double total = 0.0;
+    for (const Centroid& centroid : sorted)
+    {
+        total += centroid.weight;
+    }
+
+    // Greedily merge neighbours while the merged centroid spans at most one
+    // unit of the scale function.
+    std::vector<Centroid> centroids;
+    Centroid current     = sorted.front();
+    double weight_so_far = 0.0;
+    double weight_limit  = total * inverse_scale(scale(0.0, compression_) + 1.0, compression_);
+    for (std::size_t i = 1; i < sorted.size(); ++i)
+    {
+        const Centroid& next = sorted[i];
+        if (weight_so_far + current.weight + next.weight <= weight_limit)
+        {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        }
+        else
+        {
+            weight_so_far += current.weight;
+            centroids.push_back(current);
+            current = next;
+            weight_limit =
+                total *
+                inverse_scale(scale(weight_so_far / total, compression_) + 1.0, compression_);
+        }
+    }
+    centroids.push_back(current);
+    return centroids;
+}
+
+void TDigest::compress()
+{
+    centroids_ = merged();
+    buffer_.clear();
+}
+
+std::uint64_t TDigest::count() const
+{
+    return count_;
+}
+
+std::size_t TDigest::size() const
+{
+    return merged().size();
+}
+
+float TDigest::quantile(const double& probability) const
+{
+    if (count_ == 0)
+    {
+        return stats::undefined();
+    }
+
+    const std::vector<Centroid> centroids = merged();
+
+    const double total   = static_cast<double>(count_);
+    const double index   = std::min(std::max(probability, 0.0), 1.0) * total;
+    const double minimum = static_cast<double>(minimum_);
+    const double maximum = static_cast<double>(maximum_);
+
+    if (index < 1.0)
+    {
+        return minimum_;
+    }
+    if (index > total - 1.0)
+    {
+        return maximum_;
+    }
+
+    // between the minimum and the first centroid's centre
+    const Centroid& first = centroids.front();
+    if (first.weight > 1.0 && index < first.weight / 2.0)
+    {
+        const double fraction = (index - 1.0) / (first.weight / 2.0 - 1.0);
+        return static_cast<float>(minimum + fraction * (first.mean - minimum));
+    }
+
+    // between centroid centres, treating singletons as exact
+    double weight_so_far = first.weight / 2.0;
+    for (std::size_t i = 0; i + 1 < centroids.size(); ++i)
+    {
+        const Centroid& left  = centroids[i];
+        const Centroid& right = centroids[i + 1];
+        const double step     = (left.weight + right.weight) / 2.0;
+        if (weight_so_far + step > index)
+        {
+            double left_unit = 0.0;
+            if (left.weight == 1.0)
+            {
+                if (index - weight_so_far < 0.5)
+                {
+                    return static_cast<float>(left.mean);
+                }
+                left_unit = 0.5;
+            }
+            double right_unit = 0.0;
+            if (right.weight == 1.0)
+            {
+                if (weight_so_far + step - index <= 0.5)
+                {
+                    return static_cast<float>(right.mean);
+                }
+                right_unit = 0.5;
+            }
+            const double to_left  = index - weight_so_far - left_unit;
+            const double to_right = weight_so_far + step - index - right_unit;
+            return static_cast<float>((left.mean * to_right + right.mean * to_left) /
+                                      (to_left + to_right));
+        }
+        weight_so_far += step;
+    }
+
+    // between the last centroid's centre and the maximum
+    const Centroid& last    = centroids.back();
+    const double to_last    = index - (total - last.weight / 2.0);
+    const double to_maximum = last.weight / 2.0 - to_last;
+    return static_cast<float>((last.mean * to_maximum + maximum * to_last) /
+                              (to_last + to_maximum));
+}
+
+TDigest TDigest::operator+(const TDigest& that) const
+{
+    TDigest combined(std::max(this->compression_, that.compression_));
+
+    combined.buffer_ = this->centroids_;
+    combined.buffer_.insert(combined.buffer_.end(), this->buffer_.begin(), this->buffer_.end());
+    combined.buffer_.insert(combined.buffer_.end(), that.centroids_.begin(),
+                            that.centroids_.end());
+    combined.buffer_.insert(combined.buffer_.end(), that.buffer_.begin(), that.buffer_.end());
+
+    combined.count_   = this->count_ + that.count_;
+    combined.minimum_ = std::min(this->minimum_, that.minimum_);
+    combined.maximum_ = std::max(this->maximum_, that.maximum_);
+
+    combined.compress();
+    return combined;
+}
+
+TDigest& TDigest::operator+=(const TDigest& rhs)
+{
+    TDigest combined = *this + rhs;
+    *this            = combined;
+    return *this;
+}
+
+std::string TDigest::serialize() const
+{
+    const std::vector<Centroid> centroids = merged();
+
+    std::string bytes;
+    bytes.push_back(static_cast<char>(kFormatVersion));
+    put(bytes, compression_);
+    put(bytes, minimum_);
+    put(bytes, maximum_);
+    put_varint(bytes, centroids.size());
+    for (const Centroid& centroid : centroids)
+    {
+        put(bytes, static_cast<float>(centroid.mean));
+        put_varint(bytes, static_cast<std::uint64_t>(llround(centroid.weight)));
+    }
+    return bytes;
+}
+
+bool TDigest::deserialize(const std::string& bytes)
+{
+    if (bytes.empty() || static_cast<unsigned char>(bytes[0]) != kFormatVersion)
+    {
+        return false;
+    }
+
+    std::size_t offset = 1;
+    TDigest digest;
+    std::uint64_t size = 0;
+    if (!get(bytes, offset, digest.compression_) || !get(bytes, offset, digest.minimum_) ||
+        !get(bytes, offset, digest.maximum_) || !get_varint(bytes, offset, size) ||
+        !(digest.compression_ >= kMinimumCompression) ||
+        !(digest.compression_ <= kMaximumCompression) || size > bytes.size())
+    {
+        return false;
+    }
+
+    // quantile() needs finite, sorted means between the extremes, and
+    // weights that sum to the count without wrapping
+    if (size > 0 && !(std::isfinite(digest.minimum_) && std::isfinite(digest.maximum_) &&
+                      digest.minimum_ <= digest.maximum_))
+    {
+        return false;
+    }
+    float previous = digest.minimum_;
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        float mean           = 0.F;
+        std::uint64_t weight = 0;
+        if (!get(bytes, offset, mean) || !get_varint(bytes, offset, weight) || weight == 0 ||
+            !(mean >= previous && mean <= digest.maximum_) ||
+            weight > std::numeric_limits<std::uint64_t>::max() - digest.count_)
+        {
+            return false;
+        }
+        digest.centroids_.push_back({static_cast<double>(mean), static_cast<double>(weight)});
+        digest.count_ += weight;
+        previous = mean;
+    }
+    if (offset != bytes.size())
+    {
+        return false;
+    }
+
+    *this = digest;
+    return true;
+}
+
+} // namespace stats
@@ -0,0 +1,151 @@
+#include "stats/WindowedStatistics.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace stats
+{
+
+WindowedStatistics::WindowedStatistics(std::int64_t bucket_width, std::size_t number_of_buckets,
+                                       std::int64_t allowed_lateness)
+    : bucket_width_(std::max<std::int64_t>(bucket_width, 1))
+    , allowed_lateness_(std::max<std::int64_t>(allowed_lateness, 0))
+    , buckets_(std::max<std::size_t>(number_of_buckets, 1))
+    , bucket_numbers_(buckets_.size(), std::numeric_limits<std::int64_t>::min())
+    , latest_timestamp_(std::numeric_limits<std::int64_t>::min())
+    , newest_bucket_(std::numeric_limits<std::int64_t>::min())
+    , late_(0)
+    , empty_(true)
+{
+}
+
+std::int64_t WindowedStatistics::bucket_number(const std::int64_t& timestamp) const
+{
+    // rounds down for negative timestamps too
+    const std::int64_t quotient = timestamp / bucket_width_;
+    return quotient - (timestamp % bucket_width_ < 0 ? 1 : 0);
+}
+
+std::size_t WindowedStatistics::slot(const std::int64_t& bucket_number) const
+{
+    const std::int64_t number_of_buckets = static_cast<std::int64_t>(buckets_.size());
+    return static_cast<std::size_t>(
+        ((bucket_number % number_of_buckets) + number_of_buckets) % number_of_buckets);
+}
+
+std::int64_t WindowedStatistics::oldest_bucket() const
+{
+    // the ring holds the newest bucket and the ones before it, down to the
+    // lowest bucket number
+    const std::int64_t lowest    = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t preceding = static_cast<std::int64_t>(buckets_.size()) - 1;
+    return std::max(newest_bucket_, lowest + preceding) - preceding;
+}
+
+bool WindowedStatistics::retained(const std::int64_t& bucket_number) const
+{
+    return !empty_ && bucket_number <= newest_bucket_ && bucket_number >= oldest_bucket();
+}
+
+bool WindowedStatistics::add(const std::int64_t& timestamp, const float& value)
+{
+    const std::int64_t number = bucket_number(timestamp);
+    if (!empty_)
+    {
+        const bool sealed = number < bucket_number(watermark());
+        if (sealed || number < oldest_bucket())
+        {
+            ++late_;
+            return false;
+        }
+    }
+
+    if (empty_ || timestamp > latest_timestamp_)
+    {
+        latest_timestamp_ = timestamp;
+        newest_bucket_    = std::max(newest_bucket_, number);
+        empty_            = false;
+    }
+
+    const std::size_t slot = this->slot(number);
+    if (bucket_numbers_[slot] != number)
+    {
+        bucket_numbers_[slot] = number;
+        buckets_[slot]        = StatisticsAccumulator();
+    }
+    buckets_[slot].add(value);
+    return true;
+}
+
+std::int64_t WindowedStatistics::bucket_width() const
+{
+    return bucket_width_;
+}
+
+std::int64_t WindowedStatistics::watermark() const
+{
+    if (empty_)
+    {
+        return std::numeric_limits<std::int64_t>::min();
+    }
+
+    // saturates rather than running below the lowest timestamp
+    const std::int64_t lowest = std::numeric_limits<std::int64_t>::min();
+    return latest_timestamp_ < lowest + allowed_lateness_ ? lowest
+                                                          : latest_timestamp_ - allowed_lateness_;
+}
+
+bool WindowedStatistics::sealed(const std::int64_t& timestamp) const
+{
+    return !empty_ && bucket_number(timestamp) <= bucket_number(watermark());
+}
+
+std::uint64_t WindowedStatistics::late() const
+{
+    return late_;
+}
+
+StatisticsAccumulator WindowedStatistics::bucket(const std::int64_t& timestamp) const
+{
+    const std::int64_t number = bucket_number(timestamp);
+    if (!retained(number))
+    {
+        return StatisticsAccumulator();
+    }
+
+    const std::size_t slot = this->slot(number);
+    return bucket_numbers_[slot] == number ? buckets_[slot] : StatisticsAccumulator();
+}
+
+StatisticsAccumulator WindowedStatistics::window(const std::int64_t& start,
+                                                 const std::int64_t& end) const
+{
+    StatisticsAccumulator combined;
+    if (empty_)
+    {
+        return combined;
+    }
+
+    // Only the retained buckets can hold values, so walk those, without
+    // stepping past either end of the int64 range.
+    const std::int64_t first = std::max(bucket_number(start), oldest_bucket());
+    const std::int64_t after = bucket_number(end);
+    if (after <= first || first > newest_bucket_)
+    {
+        return combined;
+    }
+
+    const std::int64_t last = std::min(after - 1, newest_bucket_);
+    for (std::int64_t offset = 0; offset <= last - first; ++offset)
+    {
+        const std::int64_t number = first + offset;
+        const std::size_t slot    = this->slot(number);
+        if (bucket_numbers_[slot] == number)
+        {
+            combined += buckets_[slot];
+        }
+    }
+    return combined;
+}
+
+} // namespace stats
@@ -0,0 +1,78 @@
+#include "stats/BufferedStatisticsAccumulator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "stats/StatisticsReport.hpp"
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(BufferedStatisticsAccumulator, BehavesWellWithNoValues)
+{
+    stats::BufferedStatisticsAccumulator statistics;
+
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.minimum()));
+    EXPECT_TRUE(stats::undefined(statistics.maximum()));
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+    EXPECT_TRUE(stats::undefined(statistics.absolute_mean()));
+    EXPECT_TRUE(stats::undefined(statistics.quadratic_mean()));
+    EXPECT_TRUE(stats::undefined(statistics.standard_deviation()));
+    EXPECT_TRUE(stats::undefined(statistics.skewness()));
+    EXPECT_TRUE(stats::undefined(statistics.kurtosis()));
+}
+
+TEST(BufferedStatisticsAccumulator, CountsBufferedValues)
+{
+    stats::BufferedStatisticsAccumulator statistics;
+
+    statistics.add(1.F);
+    statistics.add(2.F);
+
+    EXPECT_EQ(2U, statistics.count());
+    EXPECT_EQ(1.5F, statistics.mean());
+
+    statistics.add(3.F);
+    EXPECT_EQ(3U, statistics.count());
+    EXPECT_EQ(2.F, statistics.mean());
+}
+
+TEST(BufferedStatisticsAccumulator, AgreesWithDocumentedExample)
+{
+    stats::BufferedStatisticsAccumulator statistics;
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(documented_test_set::absolute_mean(), statistics.absolute_mean());
+    EXPECT_FLOAT_EQ(documented_test_set::quadratic_mean(), statistics.quadratic_mean());
+    EXPECT_FLOAT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+    EXPECT_EQ(documented_test_set::statistics_description(),
+              stats::description(statistics.statistics()));
+}
+
+TEST(BufferedStatisticsAccumulator, ReadsThroughConstReferences)
+{
+    stats::BufferedStatisticsAccumulator statistics;
+    statistics.add(1.F);
+    statistics.add(5.F);
+
+    // the buffered values are read without flushing them
+    const stats::BufferedStatisticsAccumulator& shared = statistics;
+    EXPECT_EQ(2U, shared.count());
+    EXPECT_EQ(1.F, shared.minimum());
+    EXPECT_EQ(3.F, shared.mean());
+    EXPECT_EQ(2U, shared.statistics().count());
+
+    statistics.flush();
+    EXPECT_EQ(2U, shared.count());
+    EXPECT_EQ(5.F, shared.maximum());
+    EXPECT_EQ(3.F, shared.mean());
+}
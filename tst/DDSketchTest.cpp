@@ -0,0 +1,212 @@
+#include "stats/DDSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values spanning ten orders of magnitude, with both signs and some zeros.
+std::vector<float> heavy_tailed_values()
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+        const float magnitude = std::pow(10.F, -5.F + 10.F * static_cast<float>(i) / 20000.F);
+        values.push_back(i % 3 == 0 ? -magnitude : magnitude);
+        if (i % 100 == 0)
+        {
+            values.push_back(0.F);
+        }
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+float exact_quantile(const std::vector<float>& sorted, const double& probability)
+{
+    return sorted[static_cast<std::size_t>(probability * static_cast<double>(sorted.size() - 1))];
+}
+
+} // unnamed namespace
+
+TEST(DDSketch, BehavesWellWithNoValues)
+{
+    stats::DDSketch sketch;
+
+    EXPECT_EQ(0U, sketch.count());
+    EXPECT_EQ(0U, sketch.size());
+    EXPECT_TRUE(stats::undefined(sketch.quantile(0.5)));
+}
+
+TEST(DDSketch, AgreesWithDocumentedExample)
+{
+    stats::DDSketch sketch(0.01);
+
+    sketch.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ(documented_test_set::count(), sketch.count());
+    EXPECT_EQ(documented_test_set::minimum(), sketch.quantile(0.0));
+    EXPECT_NEAR(documented_test_set::median(), sketch.quantile(0.5), 0.01F * 67.F);
+    EXPECT_EQ(documented_test_set::maximum(), sketch.quantile(1.0));
+}
+
+TEST(DDSketch, KeepsRelativeAccuracyAcrossMagnitudesAndSigns)
+{
+    const std::vector<float> values = heavy_tailed_values();
+    stats::DDSketch sketch(0.01);
+    for (const float& value : values)
+    {
+        sketch.add(value);
+    }
+
+    for (const double probability : {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999})
+    {
+        const float exact = exact_quantile(values, probability);
+        EXPECT_NEAR(exact, sketch.quantile(probability), 0.01F * std::fabs(exact) * 1.0001F)
+            << "probability " << probability;
+    }
+}
+
+TEST(DDSketch, AddsArraysLikeSingleValues)
+{
+    const std::vector<float> values = heavy_tailed_values();
+    stats::DDSketch one_by_one(0.02);
+    stats::DDSketch arrays(0.02);
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), values.size());
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.size(), arrays.size());
+    for (const double probability : {0.0, 0.05, 0.5, 0.95, 1.0})
+    {
+        EXPECT_EQ(one_by_one.quantile(probability), arrays.quantile(probability));
+    }
+}
+
+TEST(DDSketch, CombinesExactlyWithTheSameAccuracy)
+{
+    const std::vector<float> values = heavy_tailed_values();
+    stats::DDSketch all(0.01);
+    stats::DDSketch first_half(0.01);
+    stats::DDSketch second_half(0.01);
+    all.add(values.data(), values.size());
+    first_half.add(values.data(), values.size() / 2);
+    second_half.add(values.data() + values.size() / 2, values.size() - values.size() / 2);
+
+    stats::DDSketch combined = first_half + second_half;
+
+    EXPECT_EQ(all.count(), combined.count());
+    EXPECT_EQ(all.size(), combined.size());
+    for (const double probability : {0.0, 0.01, 0.5, 0.99, 1.0})
+    {
+        EXPECT_EQ(all.quantile(probability), combined.quantile(probability));
+    }
+
+    first_half += second_half;
+    EXPECT_EQ(all.quantile(0.5), first_half.quantile(0.5));
+}
+
+TEST(DDSketch, CombinesWithDifferentAccuracy)
+{
+    const std::vector<float> values = heavy_tailed_values();
+    stats::DDSketch fine(0.01);
+    stats::DDSketch coarse(0.05);
+    fine.add(values.data(), values.size() / 2);
+    coarse.add(values.data() + values.size() / 2, values.size() - values.size() / 2);
+
+    stats::DDSketch combined = fine + coarse;
+
+    EXPECT_EQ(values.size(), combined.count());
+    EXPECT_EQ(0.01, combined.relative_accuracy());
+    for (const double probability : {0.1, 0.5, 0.9})
+    {
+        const float exact = exact_quantile(values, probability);
+        EXPECT_NEAR(exact, combined.quantile(probability), 0.07F * std::fabs(exact));
+    }
+}
+
+TEST(DDSketch, CollapsesLowestBucketsUnderMemoryCap)
+{
+    const std::vector<float> values = heavy_tailed_values();
+    stats::DDSketch sketch(0.01, 256);
+    sketch.add(values.data(), values.size());
+
+    EXPECT_EQ(values.size(), sketch.count());
+    EXPECT_LE(sketch.size(), 2U * 256U + 1U);
+
+    // the largest magnitudes keep their accuracy
+    for (const double probability : {0.0001, 0.999})
+    {
+        const float exact = exact_quantile(values, probability);
+        EXPECT_NEAR(exact, sketch.quantile(probability), 0.01F * std::fabs(exact) * 1.0001F);
+    }
+}
+
+TEST(DDSketch, StaysUnderMemoryCapForExtremeRanges)
+{
+    // at this accuracy, 1e-30 to 1e30 spans about 69 million buckets
+    stats::DDSketch sketch(1.0e-6, 2048);
+
+    for (const float value : {1.0e-30F, 1.0e30F, 1.0e-20F, -1.0e30F, -1.0e-30F, 1.0e20F})
+    {
+        sketch.add(value);
+        EXPECT_LE(sketch.size(), 2U * 2048U);
+    }
+
+    EXPECT_EQ(6U, sketch.count());
+    EXPECT_EQ(-1.0e30F, sketch.quantile(0.0));
+    EXPECT_EQ(1.0e30F, sketch.quantile(1.0));
+
+    // the smaller positive values collapse in to the lowest bucket kept,
+    // 2048 buckets of 2e-6 below the largest value
+    EXPECT_NEAR(1.0e30F, sketch.quantile(0.99), 1.0e30F * 0.005F);
+}
+
+TEST(DDSketch, OrdersSignsInfinitiesAndNan)
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+    const float nan      = std::numeric_limits<float>::quiet_NaN();
+
+    stats::DDSketch sketch;
+    stats::DDSketch array_sketch;
+    std::vector<float> values;
+    for (int i = 1; i <= 100; ++i)
+    {
+        values.push_back(static_cast<float>(i));
+    }
+    values.push_back(infinity);
+    values.push_back(-infinity);
+    values.push_back(nan);
+    values.push_back(infinity);
+    for (const float& value : values)
+    {
+        sketch.add(value);
+    }
+    array_sketch.add(values.data(), values.size());
+
+    stats::DDSketch combined = sketch + array_sketch;
+    EXPECT_EQ(2 * sketch.count(), combined.count());
+    EXPECT_EQ(infinity, combined.quantile(0.999));
+
+    for (const stats::DDSketch* tested : {&sketch, &array_sketch})
+    {
+        EXPECT_EQ(104U, tested->count());
+        EXPECT_EQ(-infinity, tested->quantile(0.0));
+        EXPECT_EQ(-infinity, tested->quantile(0.005));
+        EXPECT_EQ(0.F, tested->quantile(0.01)); // the NaN
+        EXPECT_NEAR(50.F, tested->quantile(0.5), 0.5F);
+        EXPECT_NEAR(100.F, tested->quantile(0.985), 1.F);
+        EXPECT_EQ(infinity, tested->quantile(0.999));
+        EXPECT_EQ(infinity, tested->quantile(1.0));
+    }
+}
@@ -0,0 +1,163 @@
+#include "stats/DecayedHistogram.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(DecayedHistogram, BehavesWellWithNoValues)
+{
+    stats::DecayedHistogram histogram(10.0, 1.0F, 1000.0F);
+
+    EXPECT_EQ(10.0, histogram.half_life());
+    EXPECT_EQ(0U, histogram.count());
+    EXPECT_EQ(0.0, histogram.weight());
+    EXPECT_TRUE(stats::undefined(histogram.quantile(0.5)));
+}
+
+TEST(DecayedHistogram, AgreesWithDocumentedExample)
+{
+    // a half-life far longer than the timestamps weighs every value the same
+    stats::DecayedHistogram histogram(1.0e12, 1.0F, 1000.0F);
+
+    double timestamp = 0.0;
+    for (const float& value : documented_test_set::values())
+    {
+        histogram.record(timestamp, value);
+        timestamp += 1.0;
+    }
+
+    EXPECT_EQ(documented_test_set::count(), histogram.count());
+    EXPECT_NEAR(100.0, histogram.weight(), 1.0e-6);
+    EXPECT_NEAR(documented_test_set::minimum(), histogram.quantile(0.0), 61.F / 128.F);
+    EXPECT_NEAR(documented_test_set::median(), histogram.quantile(0.5), 67.F / 128.F);
+    EXPECT_NEAR(documented_test_set::maximum(), histogram.quantile(1.0), 73.F / 128.F);
+}
+
+TEST(DecayedHistogram, HalvesWeightsEveryHalfLife)
+{
+    stats::DecayedHistogram histogram(4.0, 1.0F, 1000.0F);
+
+    histogram.record(0.0, 10.0F);
+    histogram.record(4.0, 20.0F);
+    EXPECT_DOUBLE_EQ(1.5, histogram.weight());
+
+    histogram.record(12.0, 30.0F);
+    EXPECT_DOUBLE_EQ(1.375, histogram.weight());
+    EXPECT_EQ(12.0, histogram.time());
+}
+
+TEST(DecayedHistogram, FavoursRecentValues)
+{
+    stats::DecayedHistogram histogram(10.0, 1.0F, 10000.0F);
+
+    std::vector<float> old_values(1000, 10.0F);
+    std::vector<float> new_values(100, 1000.0F);
+    histogram.record(0.0, old_values.data(), old_values.size());
+    EXPECT_NEAR(10.F, histogram.quantile(0.99), 10.F / 128.F);
+
+    // 1000 values 10 half-lives old weigh less than 1 new value
+    histogram.record(100.0, new_values.data(), new_values.size());
+    EXPECT_NEAR(1000.F, histogram.quantile(0.5), 1000.F / 128.F);
+    EXPECT_NEAR(10.F, histogram.quantile(0.005), 10.F / 128.F);
+    EXPECT_NEAR(100.0 + 1000.0 / 1024.0, histogram.weight(), 1.0e-9);
+}
+
+TEST(DecayedHistogram, WeighsLateValuesAsIfInOrder)
+{
+    stats::DecayedHistogram in_order(10.0, 1.0F, 1000.0F);
+    stats::DecayedHistogram late(10.0, 1.0F, 1000.0F);
+
+    in_order.record(0.0, 5.0F);
+    in_order.record(5.0, 50.0F);
+    in_order.record(20.0, 500.0F);
+
+    late.record(0.0, 5.0F);
+    late.record(20.0, 500.0F);
+    late.record(5.0, 50.0F);
+
+    EXPECT_DOUBLE_EQ(in_order.weight(), late.weight());
+    for (const double& probability : {0.1, 0.3, 0.5, 0.7, 0.9})
+    {
+        EXPECT_EQ(in_order.quantile(probability), late.quantile(probability));
+    }
+}
+
+TEST(DecayedHistogram, MovesTheLandmarkBeforeWeightsOverflow)
+{
+    stats::DecayedHistogram histogram(1.0, 1.0F, 1000.0F);
+
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        histogram.record(static_cast<double>(i) * 0.1, i % 2 == 0 ? 10.0F : 100.0F);
+    }
+
+    // weights of values 10 apart halve every ten values, so the sum is 1 / (1 - 2^-0.1)
+    EXPECT_GT(histogram.landmark(), 0.0);
+    EXPECT_TRUE(std::isfinite(histogram.weight()));
+    EXPECT_NEAR(1.0 / (1.0 - exp2(-0.1)), histogram.weight(), 1.0e-6);
+    EXPECT_NEAR(100.F, histogram.quantile(0.6), 1.0F);
+    EXPECT_NEAR(10.F, histogram.quantile(0.4), 0.1F);
+}
+
+TEST(DecayedHistogram, RecordsArraysLikeSingleValues)
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        values.push_back(static_cast<float>(1 + (i * 7919) % 900));
+    }
+
+    stats::DecayedHistogram one_by_one(50.0, 1.0F, 1000.0F);
+    stats::DecayedHistogram arrays(50.0, 1.0F, 1000.0F);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        one_by_one.record(static_cast<double>(i / 100), values[i]);
+    }
+    for (std::size_t first = 0; first < values.size(); first += 100)
+    {
+        arrays.record(static_cast<double>(first / 100), values.data() + first, 100);
+    }
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_NEAR(one_by_one.weight(), arrays.weight(), 1.0e-9 * one_by_one.weight());
+    for (const double& probability : {0.0, 0.01, 0.5, 0.99, 1.0})
+    {
+        EXPECT_EQ(one_by_one.quantile(probability), arrays.quantile(probability));
+    }
+}
+
+TEST(DecayedHistogram, CombinesHistogramsWithDifferentLandmarks)
+{
+    stats::DecayedHistogram all(5.0, 1.0F, 1000.0F);
+    stats::DecayedHistogram early(5.0, 1.0F, 1000.0F);
+    stats::DecayedHistogram late(5.0, 1.0F, 1000.0F);
+
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        const double timestamp = static_cast<double>(i) * 0.5;
+        const float value      = static_cast<float>(1 + (i * 37) % 500);
+        all.record(timestamp, value);
+        (i < 120 ? early : late).record(timestamp, value);
+    }
+
+    stats::DecayedHistogram combined = late + early;
+    combined += stats::DecayedHistogram(5.0, 1.0F, 1000.0F);
+
+    EXPECT_EQ(all.count(), combined.count());
+    EXPECT_EQ(all.time(), combined.time());
+    EXPECT_NEAR(all.weight(), combined.weight(), 1.0e-9 * all.weight());
+    for (const double& probability : {0.0, 0.1, 0.5, 0.9, 1.0})
+    {
+        EXPECT_EQ(all.quantile(probability), combined.quantile(probability));
+    }
+
+    // different buckets re-record at bucket middles
+    stats::DecayedHistogram coarse(5.0, 1.0F, 1000.0F, 3);
+    coarse += all;
+    EXPECT_EQ(all.count(), coarse.count());
+    EXPECT_NEAR(all.weight(), coarse.weight(), 1.0e-9 * all.weight());
+    EXPECT_NEAR(all.quantile(0.5), coarse.quantile(0.5), all.quantile(0.5) / 8.F);
+}
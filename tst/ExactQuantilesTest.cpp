@@ -0,0 +1,173 @@
+#include "stats/ExactQuantiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+// Values of both signs over several magnitudes, with many repeats.
+std::vector<float> mixed_values(std::size_t number_of_values)
+{
+    std::vector<float> values(number_of_values);
+    std::uint64_t state = 88172645463325252ULL;
+    for (float& value : values)
+    {
+        state ^= state << 13U;
+        state ^= state >> 7U;
+        state ^= state << 17U;
+        const float magnitude = static_cast<float>(state % 100000) / 100.F;
+        value                 = (state & 0x100000U) != 0 ? -magnitude : magnitude * magnitude;
+    }
+    return values;
+}
+
+// Type 7 quantile, by sorting.
+float sorted_quantile(std::vector<float> values, const double& probability)
+{
+    std::sort(values.begin(), values.end());
+    const double position   = probability * static_cast<double>(values.size() - 1);
+    const std::size_t below = static_cast<std::size_t>(position);
+    const double fraction   = position - static_cast<double>(below);
+    const double lower      = values[below];
+    if (fraction == 0.0)
+    {
+        return values[below];
+    }
+    const double upper = values[below + 1];
+    return static_cast<float>(lower + fraction * (upper - lower));
+}
+
+} // unnamed namespace
+
+TEST(ExactQuantiles, BehavesWellWithNoValues)
+{
+    stats::ExactQuantiles engine;
+
+    EXPECT_TRUE(stats::undefined(engine.median(nullptr, 0)));
+    EXPECT_EQ(2U, engine.quantiles(nullptr, 0, {0.1, 0.9}).size());
+}
+
+TEST(ExactQuantiles, AgreesWithDocumentedExample)
+{
+    stats::ExactQuantiles engine;
+    const std::vector<float>& values = documented_test_set::values();
+
+    EXPECT_EQ(documented_test_set::median(), engine.median(values.data(), values.size()));
+    EXPECT_EQ(documented_test_set::minimum(), engine.quantile(values.data(), values.size(), 0.0));
+    EXPECT_EQ(documented_test_set::maximum(), engine.quantile(values.data(), values.size(), 1.0));
+}
+
+TEST(ExactQuantiles, InterpolatesBetweenClosestRanks)
+{
+    stats::ExactQuantiles engine;
+    const std::vector<float> values = {4.F, 1.F, 3.F, 2.F};
+
+    EXPECT_EQ(2.5F, engine.median(values.data(), values.size()));
+    EXPECT_EQ(1.3F, engine.quantile(values.data(), values.size(), 0.1));
+}
+
+TEST(ExactQuantiles, OrdersSignsAndInfinities)
+{
+    stats::ExactQuantiles engine;
+    const float infinity            = std::numeric_limits<float>::infinity();
+    const std::vector<float> values = {3.F, -infinity, -2.F, 0.F, -1.0e-40F, infinity, 1.0e-40F};
+
+    const std::vector<float> quantiles =
+        engine.quantiles(values.data(), values.size(), {0.0, 1.0 / 6.0, 0.5, 5.0 / 6.0, 1.0});
+
+    EXPECT_EQ(-infinity, quantiles[0]);
+    EXPECT_EQ(-2.F, quantiles[1]);
+    EXPECT_EQ(0.F, quantiles[2]);
+    EXPECT_EQ(3.F, quantiles[3]);
+    EXPECT_EQ(infinity, quantiles[4]);
+}
+
+TEST(ExactQuantiles, AgreesWithSortingForManyQuantiles)
+{
+    const std::vector<float> values         = mixed_values(100001);
+    const std::vector<double> probabilities = {0.0, 0.001, 0.01, 0.1, 0.25, 0.3333, 0.5,
+                                               0.6667, 0.75, 0.9, 0.99, 0.999, 1.0};
+    stats::ExactQuantiles engine(1);
+
+    const std::vector<float> quantiles =
+        engine.quantiles(values.data(), values.size(), probabilities);
+
+    for (std::size_t i = 0; i < probabilities.size(); ++i)
+    {
+        EXPECT_EQ(sorted_quantile(values, probabilities[i]), quantiles[i])
+            << "probability " << probabilities[i];
+    }
+}
+
+TEST(ExactQuantiles, AgreesWithSortingInParallel)
+{
+    const std::vector<float> values         = mixed_values(1000003);
+    const std::vector<double> probabilities = {0.01, 0.5, 0.99};
+    stats::ExactQuantiles engine(4);
+
+    // reuse the engine, and its scratch arena, for several arrays
+    for (const std::size_t number_of_values : {values.size(), values.size() / 3, std::size_t(5)})
+    {
+        const std::vector<float> subset(values.begin(), values.begin() + number_of_values);
+        const std::vector<float> quantiles =
+            engine.quantiles(subset.data(), subset.size(), probabilities);
+        for (std::size_t i = 0; i < probabilities.size(); ++i)
+        {
+            EXPECT_EQ(sorted_quantile(subset, probabilities[i]), quantiles[i]);
+        }
+    }
+}
+
+TEST(ExactQuantiles, HandlesConstantValues)
+{
+    const std::vector<float> values(300000, 42.5F);
+    stats::ExactQuantiles engine(3);
+
+    EXPECT_EQ(42.5F, engine.median(values.data(), values.size()));
+    EXPECT_EQ(42.5F, engine.quantile(values.data(), values.size(), 0.999));
+}
+
+TEST(ExactQuantiles, LeavesNanProbabilitiesUndefined)
+{
+    const double nan                 = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<float>& values = documented_test_set::values();
+    stats::ExactQuantiles engine;
+
+    const std::vector<float> quantiles = engine.quantiles(values.data(), values.size(), {nan, 0.5});
+    EXPECT_TRUE(stats::undefined(quantiles[0]));
+    EXPECT_EQ(documented_test_set::median(), quantiles[1]);
+    EXPECT_TRUE(stats::undefined(engine.quantile(values.data(), values.size(), nan)));
+
+    stats::StatisticsAccumulator statistics;
+    engine.quantiles(values.data(), values.size(), {nan}, statistics);
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+}
+
+TEST(ExactQuantiles, AccumulatesStatisticsInTheFirstPass)
+{
+    const std::vector<float> values = mixed_values(300007);
+    stats::StatisticsAccumulator expected;
+    expected.add(values.data(), values.size());
+
+    stats::ExactQuantiles engine(3);
+    stats::StatisticsAccumulator statistics;
+    const std::vector<float> quantiles =
+        engine.quantiles(values.data(), values.size(), {0.5}, statistics);
+
+    EXPECT_EQ(sorted_quantile(values, 0.5), quantiles[0]);
+    EXPECT_EQ(expected.count(), statistics.count());
+    EXPECT_EQ(expected.minimum(), statistics.minimum());
+    EXPECT_EQ(expected.maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(expected.mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(expected.standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(expected.skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(expected.kurtosis(), statistics.kurtosis());
+}
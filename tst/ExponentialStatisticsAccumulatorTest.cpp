@@ -0,0 +1,197 @@
+#include "stats/ExponentialStatisticsAccumulator.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+#include "test_data/NoisyValues.hpp"
+
+namespace // unnamed namespace
+{
+
+// Computes the weighted moments directly, the value at times[i] weighted by
+// 2^-((latest - times[i]) / half_life).
+void expect_weighted_statistics(const stats::ExponentialStatisticsAccumulator& statistics,
+                                const std::vector<double>& times, const std::vector<float>& values)
+{
+    double latest = times[0];
+    for (const double& time : times)
+    {
+        latest = std::max(time, latest);
+    }
+
+    std::vector<double> weights;
+    double weight = 0.0;
+    double sum    = 0.0;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        weights.push_back(exp2(-(latest - times[i]) / statistics.half_life()));
+        weight += weights[i];
+        sum += weights[i] * values[i];
+    }
+    const double mean = sum / weight;
+
+    double m2 = 0.0;
+    double m3 = 0.0;
+    double m4 = 0.0;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const double delta = values[i] - mean;
+        m2 += weights[i] * delta * delta;
+        m3 += weights[i] * delta * delta * delta;
+        m4 += weights[i] * delta * delta * delta * delta;
+    }
+
+    const double standard_deviation = sqrt(m2 / weight);
+    const double skewness           = sqrt(weight) * m3 / pow(m2, 1.5);
+    const double kurtosis           = weight * m4 / (m2 * m2) - 3.0;
+
+    EXPECT_EQ(values.size(), statistics.count());
+    EXPECT_DOUBLE_EQ(latest, statistics.time());
+    EXPECT_NEAR(weight, statistics.weight(), 1.0e-9 * weight);
+    EXPECT_NEAR(mean, statistics.mean(), 1.0e-5 * fabs(mean));
+    EXPECT_NEAR(standard_deviation, statistics.standard_deviation(), 1.0e-4 * standard_deviation);
+    EXPECT_NEAR(skewness, statistics.skewness(), 1.0e-3);
+    EXPECT_NEAR(kurtosis, statistics.kurtosis(), 1.0e-3);
+}
+
+} // unnamed namespace
+
+TEST(ExponentialStatisticsAccumulator, BehavesWellWithNoValues)
+{
+    stats::ExponentialStatisticsAccumulator statistics(10.0);
+
+    EXPECT_EQ(10.0, statistics.half_life());
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_EQ(0.0, statistics.weight());
+    EXPECT_TRUE(stats::undefined(statistics.minimum()));
+    EXPECT_TRUE(stats::undefined(statistics.maximum()));
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+    EXPECT_TRUE(stats::undefined(statistics.standard_deviation()));
+    EXPECT_TRUE(stats::undefined(statistics.kurtosis()));
+}
+
+TEST(ExponentialStatisticsAccumulator, BehavesWellWithOneValue)
+{
+    stats::ExponentialStatisticsAccumulator statistics(10.0);
+
+    statistics.add(-123.4F);
+
+    EXPECT_EQ(1U, statistics.count());
+    EXPECT_EQ(1.0, statistics.weight());
+    EXPECT_EQ(-123.4F, statistics.minimum());
+    EXPECT_EQ(-123.4F, statistics.maximum());
+    EXPECT_EQ(-123.4F, statistics.mean());
+    EXPECT_EQ(123.4F, statistics.absolute_mean());
+    EXPECT_EQ(0.0F, statistics.standard_deviation());
+    EXPECT_TRUE(stats::undefined(statistics.skewness()));
+}
+
+TEST(ExponentialStatisticsAccumulator, ApproachesDocumentedExampleWithLongHalfLife)
+{
+    stats::ExponentialStatisticsAccumulator statistics(1.0e12);
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_NEAR(documented_test_set::mean(), statistics.mean(), 1.0e-4F);
+    EXPECT_NEAR(documented_test_set::standard_deviation(), statistics.standard_deviation(),
+                1.0e-4F);
+    EXPECT_NEAR(documented_test_set::skewness(), statistics.skewness(), 1.0e-4F);
+    EXPECT_NEAR(documented_test_set::kurtosis(), statistics.kurtosis(), 1.0e-4F);
+}
+
+TEST(ExponentialStatisticsAccumulator, HalvesWeightsEveryHalfLife)
+{
+    stats::ExponentialStatisticsAccumulator statistics(4.0);
+
+    statistics.add(0.0, 10.0F);
+    statistics.add(4.0, 20.0F);
+
+    // weights 1/2 and 1
+    EXPECT_DOUBLE_EQ(1.5, statistics.weight());
+    EXPECT_FLOAT_EQ(50.0F / 3.0F, statistics.mean());
+
+    statistics.add(12.0, 20.0F);
+
+    // weights 1/8, 1/4 and 1
+    EXPECT_DOUBLE_EQ(1.375, statistics.weight());
+    EXPECT_FLOAT_EQ(26.25F / 1.375F, statistics.mean());
+}
+
+TEST(ExponentialStatisticsAccumulator, WeightsIrregularTimestampsExactly)
+{
+    stats::ExponentialStatisticsAccumulator statistics(25.0);
+
+    const std::vector<float> values = noisy_values(500, 10.F);
+    std::vector<double> times;
+    double time = 1000.0;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        time += 0.25 * static_cast<double>(i % 9);
+        times.push_back(time);
+        statistics.add(time, values[i]);
+    }
+
+    expect_weighted_statistics(statistics, times, values);
+}
+
+TEST(ExponentialStatisticsAccumulator, WeightsLateValuesAsIfInOrder)
+{
+    stats::ExponentialStatisticsAccumulator statistics(25.0);
+
+    const std::vector<float> values = noisy_values(200, 10.F);
+    std::vector<double> times;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        // every third value arrives five ticks late
+        const double time = i % 3 == 2 ? static_cast<double>(i) - 5.0 : static_cast<double>(i);
+        times.push_back(time);
+        statistics.add(time, values[i]);
+    }
+
+    expect_weighted_statistics(statistics, times, values);
+}
+
+TEST(ExponentialStatisticsAccumulator, AgreesWithItselfForArrays)
+{
+    const std::vector<float> values = noisy_values(5000, 10.F);
+
+    stats::ExponentialStatisticsAccumulator one_by_one(300.0);
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+
+    // uneven pieces, to exercise the block tails
+    stats::ExponentialStatisticsAccumulator in_arrays(300.0);
+    in_arrays.add(values.data(), 3);
+    in_arrays.add(values.data() + 3, 2500);
+    in_arrays.add(values[2503]);
+    in_arrays.add(values.data() + 2504, values.size() - 2504);
+
+    EXPECT_EQ(one_by_one.count(), in_arrays.count());
+    EXPECT_DOUBLE_EQ(one_by_one.time(), in_arrays.time());
+    EXPECT_NEAR(one_by_one.weight(), in_arrays.weight(), 1.0e-9 * one_by_one.weight());
+    EXPECT_EQ(one_by_one.minimum(), in_arrays.minimum());
+    EXPECT_EQ(one_by_one.maximum(), in_arrays.maximum());
+    EXPECT_FLOAT_EQ(one_by_one.mean(), in_arrays.mean());
+    EXPECT_FLOAT_EQ(one_by_one.absolute_mean(), in_arrays.absolute_mean());
+    EXPECT_NEAR(one_by_one.standard_deviation(), in_arrays.standard_deviation(), 1.0e-5F);
+    EXPECT_NEAR(one_by_one.skewness(), in_arrays.skewness(), 1.0e-4F);
+    EXPECT_NEAR(one_by_one.kurtosis(), in_arrays.kurtosis(), 1.0e-4F);
+
+    std::vector<double> times;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        times.push_back(static_cast<double>(i + 1));
+    }
+    expect_weighted_statistics(in_arrays, times, values);
+}
@@ -0,0 +1,171 @@
+#include "stats/FrequentValuesSketch.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+// Zipf-like stream: value v, for v from 1 to 1000, occurs 10000/v times, in
+// an interleaved order.
+std::vector<float> skewed_values()
+{
+    std::vector<float> values;
+    for (std::size_t round = 0; round < 10000; ++round)
+    {
+        for (std::size_t v = 1; v <= 1000; ++v)
+        {
+            if (round < 10000 / v)
+            {
+                values.push_back(static_cast<float>(v));
+            }
+        }
+    }
+    return values;
+}
+
+std::uint64_t true_count(const float& value)
+{
+    return 10000 / static_cast<std::uint64_t>(value);
+}
+
+} // unnamed namespace
+
+TEST(FrequentValuesSketch, BehavesWellWithNoValues)
+{
+    stats::FrequentValuesSketch sketch(16);
+
+    EXPECT_EQ(0U, sketch.count());
+    EXPECT_EQ(0U, sketch.size());
+    EXPECT_EQ(16U, sketch.capacity());
+    EXPECT_EQ(0U, sketch.count(1.F));
+    EXPECT_TRUE(sketch.top(5).empty());
+}
+
+TEST(FrequentValuesSketch, AgreesWithDocumentedExample)
+{
+    stats::FrequentValuesSketch sketch(16);
+
+    sketch.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    // with fewer distinct values than the capacity, the counts are exact
+    std::map<float, std::uint64_t> expected;
+    for (const float& value : documented_test_set::values())
+    {
+        ++expected[value];
+    }
+
+    EXPECT_EQ(documented_test_set::count(), sketch.count());
+    EXPECT_EQ(expected.size(), sketch.size());
+    for (const auto& value_and_count : expected)
+    {
+        EXPECT_EQ(value_and_count.second, sketch.count(value_and_count.first));
+    }
+
+    const std::vector<stats::FrequentValue> top = sketch.top(1);
+    ASSERT_EQ(1U, top.size());
+    EXPECT_EQ(documented_test_set::median(), top[0].value); // the mode is 67
+    EXPECT_EQ(0U, top[0].error);
+}
+
+TEST(FrequentValuesSketch, FindsHeavyHittersWithBoundedError)
+{
+    const std::vector<float> values = skewed_values();
+    stats::FrequentValuesSketch sketch(100);
+    for (const float& value : values)
+    {
+        sketch.add(value);
+    }
+
+    const std::uint64_t error_bound = sketch.count() / sketch.capacity();
+    EXPECT_EQ(100U, sketch.size());
+
+    // every value occurring more than count/capacity times is tracked
+    for (std::size_t v = 1; true_count(static_cast<float>(v)) > error_bound; ++v)
+    {
+        const float value = static_cast<float>(v);
+        EXPECT_GE(sketch.count(value), true_count(value));
+        EXPECT_LE(sketch.count(value), true_count(value) + error_bound);
+    }
+
+    const std::vector<stats::FrequentValue> top = sketch.top(3);
+    ASSERT_EQ(3U, top.size());
+    EXPECT_EQ(1.F, top[0].value);
+    EXPECT_EQ(2.F, top[1].value);
+    EXPECT_EQ(3.F, top[2].value);
+    for (const stats::FrequentValue& frequent : top)
+    {
+        EXPECT_LE(frequent.count - frequent.error, true_count(frequent.value));
+        EXPECT_GE(frequent.count, true_count(frequent.value));
+    }
+}
+
+TEST(FrequentValuesSketch, CountsZerosAndNansAsOneValueEach)
+{
+    stats::FrequentValuesSketch sketch(4);
+
+    sketch.add(0.F);
+    sketch.add(-0.F);
+    sketch.add(std::nanf(""));
+    sketch.add(-std::nanf("1"));
+
+    EXPECT_EQ(2U, sketch.size());
+    EXPECT_EQ(2U, sketch.count(0.F));
+    EXPECT_EQ(2U, sketch.count(std::nanf("")));
+}
+
+TEST(FrequentValuesSketch, AddsArraysLikeSingleValues)
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+        values.push_back(static_cast<float>((i / 7) % 300 + (i % 11 == 0 ? 1000 : 0)));
+    }
+    stats::FrequentValuesSketch one_by_one(64);
+    stats::FrequentValuesSketch arrays(64);
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), values.size());
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.size(), arrays.size());
+
+    // ties for the lowest count may replace different values, so compare
+    // within the error bound
+    const std::uint64_t error_bound = arrays.count() / arrays.capacity();
+    for (const stats::FrequentValue& frequent : arrays.top(10))
+    {
+        EXPECT_NEAR(static_cast<double>(one_by_one.count(frequent.value)),
+                    static_cast<double>(frequent.count), static_cast<double>(error_bound));
+    }
+}
+
+TEST(FrequentValuesSketch, CombinesSketches)
+{
+    const std::vector<float> values = skewed_values();
+    stats::FrequentValuesSketch first_half(100);
+    stats::FrequentValuesSketch second_half(100);
+    first_half.add(values.data(), values.size() / 2);
+    second_half.add(values.data() + values.size() / 2, values.size() - values.size() / 2);
+
+    stats::FrequentValuesSketch combined = first_half + second_half;
+    first_half += second_half;
+
+    EXPECT_EQ(values.size(), combined.count());
+    EXPECT_EQ(100U, combined.size());
+    EXPECT_EQ(combined.count(1.F), first_half.count(1.F));
+
+    const std::uint64_t error_bound = combined.count() / combined.capacity();
+    for (std::size_t v = 1; true_count(static_cast<float>(v)) > error_bound; ++v)
+    {
+        const float value = static_cast<float>(v);
+        EXPECT_GE(combined.count(value), true_count(value));
+        EXPECT_LE(combined.count(value), true_count(value) + error_bound);
+    }
+}
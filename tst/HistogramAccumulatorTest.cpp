@@ -0,0 +1,146 @@
+#include "stats/HistogramAccumulator.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(HistogramAccumulator, BehavesWellWithNoValues)
+{
+    stats::HistogramAccumulator histogram(0.F, 10.F, 5);
+
+    EXPECT_EQ(0U, histogram.count());
+    EXPECT_EQ(5U, histogram.number_of_bins());
+    for (std::size_t bin = 0; bin < histogram.number_of_bins(); ++bin)
+    {
+        EXPECT_EQ(0U, histogram.count(bin));
+    }
+    EXPECT_EQ(0U, histogram.underflow());
+    EXPECT_EQ(0U, histogram.overflow());
+}
+
+TEST(HistogramAccumulator, AgreesWithDocumentedExample)
+{
+    stats::HistogramAccumulator histogram(61.F, 74.F, 13);
+
+    histogram.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    std::vector<std::uint64_t> expected(13, 0);
+    for (const float& value : documented_test_set::values())
+    {
+        ++expected[static_cast<std::size_t>(value) - 61];
+    }
+
+    EXPECT_EQ(documented_test_set::count(), histogram.count());
+    for (std::size_t bin = 0; bin < histogram.number_of_bins(); ++bin)
+    {
+        EXPECT_EQ(expected[bin], histogram.count(bin)) << "bin " << bin;
+    }
+    EXPECT_EQ(0U, histogram.underflow());
+    EXPECT_EQ(0U, histogram.overflow());
+}
+
+TEST(HistogramAccumulator, IncludesLowerBoundsAndExcludesUpperBounds)
+{
+    stats::HistogramAccumulator histogram(0.F, 4.F, 4);
+
+    histogram.add(0.F);
+    histogram.add(1.F);
+    histogram.add(3.999F);
+    histogram.add(4.F);
+    histogram.add(-0.001F);
+
+    EXPECT_EQ(1U, histogram.count(0));
+    EXPECT_EQ(1U, histogram.count(1));
+    EXPECT_EQ(0U, histogram.count(2));
+    EXPECT_EQ(1U, histogram.count(3));
+    EXPECT_EQ(1U, histogram.underflow());
+    EXPECT_EQ(1U, histogram.overflow());
+    EXPECT_EQ(0.F, histogram.lower_bound(0));
+    EXPECT_EQ(4.F, histogram.lower_bound(4));
+}
+
+TEST(HistogramAccumulator, CountsOutOfRangeValues)
+{
+    const std::vector<float> values = {-std::numeric_limits<float>::infinity(),
+                                       -1.0e30F,
+                                       std::nanf(""),
+                                       5.F,
+                                       1.0e30F,
+                                       std::numeric_limits<float>::infinity()};
+    stats::HistogramAccumulator histogram(0.F, 10.F, 10);
+
+    histogram.add(values.data(), values.size());
+
+    EXPECT_EQ(values.size(), histogram.count());
+    EXPECT_EQ(3U, histogram.underflow());
+    EXPECT_EQ(1U, histogram.count(5));
+    EXPECT_EQ(2U, histogram.overflow());
+}
+
+TEST(HistogramAccumulator, AddsArraysLikeSingleValues)
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 10007; ++i)
+    {
+        values.push_back(static_cast<float>((i * 7919) % 1200) / 10.F - 10.F);
+    }
+
+    stats::HistogramAccumulator one_by_one(0.F, 100.F, 37);
+    stats::HistogramAccumulator arrays(0.F, 100.F, 37);
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), values.size());
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.underflow(), arrays.underflow());
+    EXPECT_EQ(one_by_one.overflow(), arrays.overflow());
+    for (std::size_t bin = 0; bin < arrays.number_of_bins(); ++bin)
+    {
+        EXPECT_EQ(one_by_one.count(bin), arrays.count(bin));
+    }
+}
+
+TEST(HistogramAccumulator, CombinesHistograms)
+{
+    const std::vector<float>& values = documented_test_set::values();
+    stats::HistogramAccumulator all(60.F, 72.F, 12);
+    stats::HistogramAccumulator first_half(60.F, 72.F, 12);
+    stats::HistogramAccumulator second_half(60.F, 72.F, 12);
+    all.add(values.data(), values.size());
+    first_half.add(values.data(), values.size() / 2);
+    second_half.add(values.data() + values.size() / 2, values.size() - values.size() / 2);
+
+    stats::HistogramAccumulator combined = first_half + second_half;
+    first_half += second_half;
+
+    EXPECT_EQ(all.count(), combined.count());
+    EXPECT_EQ(all.overflow(), combined.overflow());
+    for (std::size_t bin = 0; bin < all.number_of_bins(); ++bin)
+    {
+        EXPECT_EQ(all.count(bin), combined.count(bin));
+        EXPECT_EQ(all.count(bin), first_half.count(bin));
+    }
+}
+
+TEST(HistogramAccumulator, CombinesHistogramsWithDifferentBins)
+{
+    stats::HistogramAccumulator coarse(0.F, 10.F, 5);
+    stats::HistogramAccumulator fine(0.F, 20.F, 20);
+    fine.add(0.5F);  // midpoint 0.5, first coarse bin
+    fine.add(3.5F);  // midpoint 3.5, second coarse bin
+    fine.add(15.F);  // overflows the coarse range
+    fine.add(-1.F);  // underflow stays underflow
+
+    stats::HistogramAccumulator combined = coarse + fine;
+
+    EXPECT_EQ(4U, combined.count());
+    EXPECT_EQ(1U, combined.count(0));
+    EXPECT_EQ(1U, combined.count(1));
+    EXPECT_EQ(1U, combined.overflow());
+    EXPECT_EQ(1U, combined.underflow());
+}
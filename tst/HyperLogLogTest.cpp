@@ -0,0 +1,131 @@
+#include "stats/HyperLogLog.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+// Distinct values first, first + 1, ... each repeated.
+std::vector<float> repeated_values(std::size_t first, std::size_t distinct, std::size_t repeats)
+{
+    std::vector<float> values;
+    for (std::size_t r = 0; r < repeats; ++r)
+    {
+        for (std::size_t i = first; i < first + distinct; ++i)
+        {
+            values.push_back(static_cast<float>(i));
+        }
+    }
+    return values;
+}
+
+} // unnamed namespace
+
+TEST(HyperLogLog, BehavesWellWithNoValues)
+{
+    stats::HyperLogLog distinct;
+
+    EXPECT_EQ(0.0, distinct.cardinality());
+    EXPECT_EQ(14U, distinct.precision());
+}
+
+TEST(HyperLogLog, AgreesWithDocumentedExample)
+{
+    stats::HyperLogLog distinct;
+
+    distinct.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    // the documented values are 61, 64, 67, 70 and 73
+    EXPECT_NEAR(5.0, distinct.cardinality(), 0.5);
+}
+
+TEST(HyperLogLog, IgnoresRepeatedValues)
+{
+    const std::vector<float> values = repeated_values(0, 1000, 50);
+    stats::HyperLogLog distinct;
+
+    distinct.add(values.data(), values.size());
+
+    EXPECT_NEAR(1000.0, distinct.cardinality(), 1000.0 * 3.0 * distinct.relative_standard_error());
+}
+
+TEST(HyperLogLog, CountsZerosAndNansOnce)
+{
+    stats::HyperLogLog distinct;
+
+    distinct.add(0.F);
+    distinct.add(-0.F);
+    distinct.add(std::nanf(""));
+    distinct.add(-std::nanf("1"));
+
+    EXPECT_NEAR(2.0, distinct.cardinality(), 0.1);
+}
+
+TEST(HyperLogLog, EstimatesLargeCardinalities)
+{
+    for (const std::size_t precision : {10U, 14U})
+    {
+        stats::HyperLogLog distinct(precision);
+        const std::vector<float> values = repeated_values(1, 1000000, 1);
+
+        distinct.add(values.data(), values.size());
+
+        EXPECT_NEAR(1.0e6, distinct.cardinality(), 1.0e6 * 3.0 * distinct.relative_standard_error())
+            << "precision " << precision;
+    }
+}
+
+TEST(HyperLogLog, AddsArraysLikeSingleValues)
+{
+    const std::vector<float> values = repeated_values(0, 5000, 3);
+    stats::HyperLogLog one_by_one;
+    stats::HyperLogLog arrays;
+
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), values.size());
+
+    EXPECT_EQ(one_by_one.cardinality(), arrays.cardinality());
+}
+
+TEST(HyperLogLog, CombinesToTheUnion)
+{
+    const std::vector<float> first  = repeated_values(0, 60000, 1);
+    const std::vector<float> second = repeated_values(40000, 60000, 1);
+    stats::HyperLogLog all;
+    stats::HyperLogLog first_only;
+    stats::HyperLogLog second_only;
+    all.add(first.data(), first.size());
+    all.add(second.data(), second.size());
+    first_only.add(first.data(), first.size());
+    second_only.add(second.data(), second.size());
+
+    stats::HyperLogLog combined = first_only + second_only;
+    first_only += second_only;
+
+    EXPECT_EQ(all.cardinality(), combined.cardinality());
+    EXPECT_EQ(all.cardinality(), first_only.cardinality());
+}
+
+TEST(HyperLogLog, CombinesDifferentPrecisions)
+{
+    const std::vector<float> values = repeated_values(0, 100000, 1);
+    stats::HyperLogLog coarse(10);
+    stats::HyperLogLog fine(14);
+    stats::HyperLogLog all(10);
+    coarse.add(values.data(), values.size() / 2);
+    fine.add(values.data() + values.size() / 2, values.size() - values.size() / 2);
+    all.add(values.data(), values.size());
+
+    // folding the fine registers gives exactly the coarse registers
+    stats::HyperLogLog combined = fine + coarse;
+
+    EXPECT_EQ(10U, combined.precision());
+    EXPECT_EQ(all.cardinality(), combined.cardinality());
+}
@@ -0,0 +1,93 @@
+#include "stats/IntervalStatisticsAccumulator.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(IntervalStatisticsAccumulator, BehavesWellWithNoValues)
+{
+    stats::IntervalStatisticsAccumulator intervals(2);
+
+    stats::StatisticsAccumulator statistics = intervals.snapshot_and_reset();
+
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+}
+
+TEST(IntervalStatisticsAccumulator, CombinesWriterSlots)
+{
+    stats::IntervalStatisticsAccumulator intervals(3);
+
+    std::size_t count = 0;
+    for (const float& value : documented_test_set::values())
+    {
+        intervals.add(count++ % 3, value);
+    }
+
+    stats::StatisticsAccumulator statistics = intervals.snapshot_and_reset();
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(IntervalStatisticsAccumulator, StartsNewIntervalAfterSnapshot)
+{
+    stats::IntervalStatisticsAccumulator intervals(1);
+
+    const std::vector<float> first = {1.F, 2.F, 3.F};
+    intervals.add(0, first.data(), first.size());
+    EXPECT_EQ(2.F, intervals.snapshot_and_reset().mean());
+
+    intervals.add(0, 10.F);
+    stats::StatisticsAccumulator second = intervals.snapshot_and_reset();
+    EXPECT_EQ(1U, second.count());
+    EXPECT_EQ(10.F, second.mean());
+
+    EXPECT_EQ(0U, intervals.snapshot_and_reset().count());
+}
+
+TEST(IntervalStatisticsAccumulator, LosesNoValuesWhileWritersRun)
+{
+    const std::size_t number_of_writers = 4;
+    const std::size_t values_per_writer = 100000;
+    stats::IntervalStatisticsAccumulator intervals(number_of_writers);
+    std::atomic<std::size_t> finished(0);
+
+    std::vector<std::thread> writers;
+    for (std::size_t w = 0; w < number_of_writers; ++w)
+    {
+        writers.emplace_back(
+            [&, w]()
+            {
+                for (std::size_t i = 0; i < values_per_writer; ++i)
+                {
+                    intervals.add(w, 2.F);
+                }
+                ++finished;
+            });
+    }
+
+    stats::StatisticsAccumulator total;
+    while (finished < number_of_writers)
+    {
+        total += intervals.snapshot_and_reset();
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    total += intervals.snapshot_and_reset();
+
+    EXPECT_EQ(number_of_writers * values_per_writer, total.count());
+    EXPECT_EQ(2.F, total.minimum());
+    EXPECT_EQ(2.F, total.maximum());
+}
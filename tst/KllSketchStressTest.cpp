@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/KllSketch.hpp"
+
+// Note that this test takes many minutes to run. It is gathered with the
+// other stress tests to avoid slowing the regular unit test program.
+
+TEST(KllSketch, Stress_KeepsRankErrorWithinBoundPastFourBillionValues)
+{
+    // Multiplying by an odd constant permutes the 32-bit integers, so the
+    // values are each of the 2^24 grid points in [0, 1) exactly 256 times,
+    // in a scrambled order. The p-quantile of the values is then p.
+
+    const uint64_t number_of_values = uint64_t(1) << 32U;
+    const std::size_t block_size    = 65536;
+
+    stats::KllSketch sketch(200);
+    std::vector<float> block(block_size);
+    uint32_t scrambled = 0;
+    for (uint64_t i = 0; i < number_of_values; i += block_size)
+    {
+        for (float& value : block)
+        {
+            value = static_cast<float>(scrambled >> 8U) / static_cast<float>(1U << 24U);
+            scrambled += 2654435761U;
+        }
+        sketch.add(block.data(), block.size());
+    }
+
+    EXPECT_EQ(number_of_values, sketch.count());
+    EXPECT_LT(sketch.size(), 3 * 200 + 2 * 32);
+
+    double largest_error = 0.0;
+    for (double probability = 0.001; probability < 1.0; probability += 0.001)
+    {
+        largest_error =
+            std::max(largest_error, std::abs(sketch.quantile(probability) - probability));
+    }
+    EXPECT_LT(largest_error, sketch.normalized_rank_error());
+}
@@ -0,0 +1,116 @@
+#include "stats/KllSketch.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace
+{ // unnamed namespace
+
+// The values 0 ... n-1 in the specified order.
+std::vector<float> ordered_values(std::size_t n, bool ascending)
+{
+    std::vector<float> values(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        values[i] = static_cast<float>(ascending ? i : n - 1 - i);
+    }
+    return values;
+}
+
+// Returns the largest difference between requested and actual ranks, for the
+// values 0 ... n-1.
+double largest_rank_error(const stats::KllSketch& sketch, std::size_t n)
+{
+    double largest = 0.0;
+    for (double probability = 0.01; probability < 1.0; probability += 0.01)
+    {
+        const double actual = (sketch.quantile(probability) + 1.0) / static_cast<double>(n);
+        largest             = std::max(largest, std::abs(actual - probability));
+    }
+    return largest;
+}
+
+} // unnamed namespace
+
+TEST(KllSketch, BehavesWellWithNoValues)
+{
+    stats::KllSketch sketch;
+
+    EXPECT_EQ(0U, sketch.count());
+    EXPECT_EQ(0U, sketch.size());
+    EXPECT_EQ(0.0, sketch.rank(1.F));
+    EXPECT_TRUE(stats::undefined(sketch.quantile(0.5)));
+}
+
+TEST(KllSketch, IsExactForFewValues)
+{
+    stats::KllSketch sketch;
+
+    sketch.add(3.F);
+    sketch.add(1.F);
+    sketch.add(2.F);
+
+    EXPECT_EQ(1.F, sketch.quantile(0.0));
+    EXPECT_EQ(2.F, sketch.quantile(0.5));
+    EXPECT_EQ(3.F, sketch.quantile(1.0));
+    EXPECT_DOUBLE_EQ(2.0 / 3.0, sketch.rank(2.F));
+}
+
+TEST(KllSketch, AgreesWithDocumentedExample)
+{
+    stats::KllSketch sketch;
+
+    sketch.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ(documented_test_set::count(), sketch.count());
+    EXPECT_EQ(documented_test_set::minimum(), sketch.quantile(0.0));
+    EXPECT_EQ(documented_test_set::median(), sketch.quantile(0.5));
+    EXPECT_EQ(documented_test_set::maximum(), sketch.quantile(1.0));
+}
+
+TEST(KllSketch, KeepsRankErrorWithinBoundForAnyOrder)
+{
+    const std::size_t n = 1000000;
+
+    for (const bool ascending : {true, false})
+    {
+        stats::KllSketch sketch(200);
+        for (const float& value : ordered_values(n, ascending))
+        {
+            sketch.add(value);
+        }
+
+        EXPECT_EQ(n, sketch.count());
+        EXPECT_LT(sketch.size(), 3 * 200 + 2 * 20);
+        EXPECT_LT(largest_rank_error(sketch, n), sketch.normalized_rank_error());
+    }
+}
+
+TEST(KllSketch, ShrinksRankErrorWithLargerK)
+{
+    EXPECT_LT(stats::KllSketch(400).normalized_rank_error(),
+              stats::KllSketch(200).normalized_rank_error());
+    EXPECT_NEAR(0.0133, stats::KllSketch(200).normalized_rank_error(), 0.0005);
+}
+
+TEST(KllSketch, CombinesResultsFromMultipleSketches)
+{
+    const std::size_t n             = 1000000;
+    const std::vector<float> values = ordered_values(n, true);
+
+    stats::KllSketch sketch1, sketch2, sketch3;
+    sketch1.add(values.data(), n / 4);
+    sketch2.add(values.data() + n / 4, n / 2);
+    sketch3.add(values.data() + 3 * n / 4, n / 4);
+
+    stats::KllSketch combined = sketch1 + sketch2;
+    combined += sketch3;
+
+    EXPECT_EQ(n, combined.count());
+    EXPECT_LT(combined.size(), 3 * 200 + 2 * 20);
+    EXPECT_LT(largest_rank_error(combined, n), combined.normalized_rank_error());
+}
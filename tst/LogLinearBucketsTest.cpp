@@ -0,0 +1,41 @@
+#include "LogLinearBuckets.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(LogLinearBuckets, KeysGrowWithValues)
+{
+    const unsigned bits = 7;
+
+    EXPECT_LT(stats::detail::log_linear_key(1.F, bits), stats::detail::log_linear_key(2.F, bits));
+    EXPECT_LT(stats::detail::log_linear_key(1.F, bits),
+              stats::detail::log_linear_key(1.01F, bits));
+    EXPECT_EQ(stats::detail::log_linear_key(1.F, bits),
+              stats::detail::log_linear_key(1.001F, bits));
+    EXPECT_EQ(0, stats::detail::log_linear_key(-1.F, bits));
+}
+
+TEST(LogLinearBuckets, SplitsEachPowerOfTwoLinearly)
+{
+    const unsigned bits    = 2;
+    const std::int32_t key = stats::detail::log_linear_key(4.F, bits);
+
+    EXPECT_EQ(4.F, stats::detail::log_linear_lower_bound(key, bits));
+    EXPECT_EQ(5.F, stats::detail::log_linear_lower_bound(key + 1, bits));
+    EXPECT_EQ(4.5F, stats::detail::log_linear_midpoint(key, bits));
+    EXPECT_EQ(8.F, stats::detail::log_linear_lower_bound(key + 4, bits));
+}
+
+TEST(LogLinearBuckets, ClampsIndexesToTheRange)
+{
+    const unsigned bits            = 2;
+    const std::int32_t lowest_key  = stats::detail::log_linear_key(1.F, bits);
+    const std::int32_t highest_key = stats::detail::log_linear_key(4.F, bits);
+
+    const std::vector<float> values = {-3.F, 0.F, 0.5F, 1.F, 1.3F, 2.F, 4.F, 100.F};
+    std::vector<std::uint32_t> indexes(values.size());
+    stats::detail::log_linear_indexes(values.data(), values.size(), bits, lowest_key,
+                                      highest_key, indexes.data());
+
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 0, 0, 0, 1, 4, 8, 8}), indexes);
+}
@@ -0,0 +1,119 @@
+#include "stats/LogLinearHistogram.hpp"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(LogLinearHistogram, BehavesWellWithNoValues)
+{
+    stats::LogLinearHistogram histogram(1.F, 1.0e9F);
+
+    EXPECT_EQ(0U, histogram.count());
+    EXPECT_TRUE(stats::undefined(histogram.minimum()));
+    EXPECT_TRUE(stats::undefined(histogram.maximum()));
+    EXPECT_TRUE(stats::undefined(histogram.quantile(0.5)));
+}
+
+TEST(LogLinearHistogram, UsesFixedMemory)
+{
+    stats::LogLinearHistogram histogram(1.F, 1.0e9F, 7);
+
+    // up to 30 powers of two, 128 buckets each
+    const std::size_t size = histogram.size();
+    EXPECT_GT(size, 29U * 128U);
+    EXPECT_LE(size, 30U * 128U);
+
+    histogram.record(1.0e12F);
+    EXPECT_EQ(size, histogram.size());
+}
+
+TEST(LogLinearHistogram, AgreesWithDocumentedExample)
+{
+    stats::LogLinearHistogram histogram(1.F, 1000.F);
+
+    histogram.record(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ(documented_test_set::count(), histogram.count());
+    EXPECT_EQ(documented_test_set::minimum(), histogram.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), histogram.maximum());
+    EXPECT_EQ(documented_test_set::minimum(), histogram.quantile(0.0));
+    EXPECT_NEAR(documented_test_set::median(), histogram.quantile(0.5), 67.F / 128.F);
+    EXPECT_EQ(documented_test_set::maximum(), histogram.quantile(1.0));
+}
+
+TEST(LogLinearHistogram, KeepsRelativePrecisionAcrossMagnitudes)
+{
+    stats::LogLinearHistogram histogram(1.F, 1.0e9F, 7);
+
+    // 1000 values in each decade from 1 to 10^9
+    std::vector<float> values;
+    for (float decade = 1.F; decade < 1.0e9F; decade *= 10.F)
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            values.push_back(decade * (1.F + 9.F * static_cast<float>(i) / 1000.F));
+        }
+    }
+    for (const float& value : values)
+    {
+        histogram.record(value);
+    }
+
+    std::sort(values.begin(), values.end());
+    for (const double probability : {0.1, 0.25, 0.5, 0.9, 0.99, 0.999})
+    {
+        const float expected = values[static_cast<std::size_t>(probability * values.size()) - 1];
+        EXPECT_NEAR(expected, histogram.quantile(probability), expected / 128.F);
+    }
+}
+
+TEST(LogLinearHistogram, CountsOutOfRangeValuesAtTheEnds)
+{
+    stats::LogLinearHistogram histogram(1.F, 100.F);
+
+    histogram.record(-5.F);
+    histogram.record(0.F);
+    histogram.record(50.F);
+    histogram.record(1000.F);
+
+    EXPECT_EQ(4U, histogram.count());
+    EXPECT_EQ(-5.F, histogram.minimum());
+    EXPECT_EQ(1000.F, histogram.maximum());
+    EXPECT_NEAR(1.F, histogram.quantile(0.5), 1.F / 128.F);
+    EXPECT_NEAR(50.F, histogram.quantile(0.75), 0.5F);
+    EXPECT_GE(histogram.quantile(1.0), 100.F);
+}
+
+TEST(LogLinearHistogram, CombinesResultsFromMultipleHistograms)
+{
+    stats::LogLinearHistogram histogram1(1.F, 1000.F), histogram2(1.F, 1000.F);
+    stats::LogLinearHistogram other_buckets(0.01F, 1.0e6F, 9);
+
+    for (std::size_t i = 1; i <= 300; ++i)
+    {
+        (i % 3 == 0 ? histogram1 : i % 3 == 1 ? histogram2 : other_buckets)
+            .record(static_cast<float>(i));
+    }
+
+    stats::LogLinearHistogram combined = histogram1 + histogram2;
+    combined += other_buckets;
+
+    EXPECT_EQ(300U, combined.count());
+    EXPECT_EQ(1.F, combined.minimum());
+    EXPECT_EQ(300.F, combined.maximum());
+    EXPECT_NEAR(150.F, combined.quantile(0.5), 2.F);
+    EXPECT_NEAR(297.F, combined.quantile(0.99), 3.F);
+}
+
+TEST(LogLinearHistogram, LeavesNanProbabilitiesUndefined)
+{
+    stats::LogLinearHistogram histogram(1.F, 1.0e9F);
+    histogram.record(1.F);
+    histogram.record(2.F);
+
+    EXPECT_TRUE(stats::undefined(histogram.quantile(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_EQ(2.F, histogram.quantile(1.0));
+}
@@ -0,0 +1,83 @@
+#include "stats/MappedFloatFile.hpp"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "stats/ExactQuantiles.hpp"
+#include "stats/StatisticsAccumulator.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+std::string write_file(const std::string& name, const std::vector<float>& values,
+                       std::size_t extra_bytes = 0)
+{
+    const std::string path = testing::TempDir() + name;
+    std::FILE* file        = std::fopen(path.c_str(), "wb");
+    if (!values.empty())
+    {
+        std::fwrite(values.data(), sizeof(float), values.size(), file);
+    }
+    for (std::size_t i = 0; i < extra_bytes; ++i)
+    {
+        std::fputc(0, file);
+    }
+    std::fclose(file);
+    return path;
+}
+
+} // unnamed namespace
+
+TEST(MappedFloatFile, BehavesWellWithMissingFile)
+{
+    stats::MappedFloatFile file(testing::TempDir() + "no_such_file.f32");
+
+    EXPECT_FALSE(file.is_open());
+    EXPECT_EQ(nullptr, file.data());
+    EXPECT_EQ(0U, file.size());
+}
+
+TEST(MappedFloatFile, BehavesWellWithEmptyFile)
+{
+    const std::string path = write_file("empty.f32", {});
+    stats::MappedFloatFile file(path);
+
+    EXPECT_TRUE(file.is_open());
+    EXPECT_EQ(0U, file.size());
+    std::remove(path.c_str());
+}
+
+TEST(MappedFloatFile, MapsWholeValues)
+{
+    const std::vector<float> values = {1.5F, -2.F, 3.25F};
+    const std::string path          = write_file("values.f32", values, 3);
+    stats::MappedFloatFile file(path);
+
+    ASSERT_TRUE(file.is_open());
+    ASSERT_EQ(values.size(), file.size());
+    EXPECT_EQ(values, std::vector<float>(file.data(), file.data() + file.size()));
+    std::remove(path.c_str());
+}
+
+TEST(MappedFloatFile, AgreesWithDocumentedExample)
+{
+    const std::string path = write_file("documented.f32", documented_test_set::values());
+    stats::MappedFloatFile file(path);
+    ASSERT_TRUE(file.is_open());
+
+    stats::ExactQuantiles engine(2);
+    stats::StatisticsAccumulator statistics;
+    const std::vector<float> quantiles =
+        engine.quantiles(file.data(), file.size(), {0.0, 0.5, 1.0}, statistics);
+
+    EXPECT_EQ(documented_test_set::minimum(), quantiles[0]);
+    EXPECT_EQ(documented_test_set::median(), quantiles[1]);
+    EXPECT_EQ(documented_test_set::maximum(), quantiles[2]);
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    std::remove(path.c_str());
+}
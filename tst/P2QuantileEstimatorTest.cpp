@@ -0,0 +1,76 @@
+#include "stats/P2QuantileEstimator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(P2QuantileEstimator, BehavesWellWithNoValues)
+{
+    stats::P2QuantileEstimator quantiles;
+
+    EXPECT_EQ(0U, quantiles.count());
+    EXPECT_TRUE(stats::undefined(quantiles.median()));
+}
+
+TEST(P2QuantileEstimator, BehavesWellWithOneValue)
+{
+    stats::P2QuantileEstimator quantiles;
+
+    quantiles.add(123.4F);
+
+    EXPECT_EQ(1U, quantiles.count());
+    EXPECT_EQ(123.4F, quantiles.median());
+}
+
+TEST(P2QuantileEstimator, IsUndefinedForUntrackedProbabilities)
+{
+    stats::P2QuantileEstimator quantiles({0.9F});
+
+    quantiles.add(1.F);
+
+    EXPECT_EQ(1.F, quantiles.quantile(0.9F));
+    EXPECT_TRUE(stats::undefined(quantiles.median()));
+    EXPECT_TRUE(stats::undefined(quantiles.quantile(0.99F)));
+}
+
+TEST(P2QuantileEstimator, IsExactForFewValues)
+{
+    stats::P2QuantileEstimator quantiles;
+
+    quantiles.add(3.F);
+    quantiles.add(1.F);
+    quantiles.add(2.F);
+    EXPECT_EQ(2.F, quantiles.median());
+
+    quantiles.add(4.F);
+    EXPECT_EQ(2.5F, quantiles.median());
+}
+
+TEST(P2QuantileEstimator, AgreesWithDocumentedExample)
+{
+    stats::P2QuantileEstimator quantiles;
+
+    for (const float& value : documented_test_set::values())
+    {
+        quantiles.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), quantiles.count());
+    EXPECT_NEAR(documented_test_set::median(), quantiles.median(), 1.F);
+}
+
+TEST(P2QuantileEstimator, EstimatesSeveralQuantilesOfUniformValues)
+{
+    stats::P2QuantileEstimator quantiles({0.99F, 0.5F, 0.9F});
+
+    // a permutation of 0 ... 10006
+    for (std::size_t i = 0; i < 10007; ++i)
+    {
+        quantiles.add(static_cast<float>((i * 7919) % 10007));
+    }
+
+    EXPECT_NEAR(5003.F, quantiles.median(), 50.F);
+    EXPECT_NEAR(9006.F, quantiles.quantile(0.9F), 50.F);
+    EXPECT_NEAR(9906.F, quantiles.quantile(0.99F), 50.F);
+}
@@ -0,0 +1,123 @@
+#include "stats/RangeStatisticsIndex.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+#include "test_data/NoisyValues.hpp"
+
+namespace // unnamed namespace
+{
+
+void expect_range_statistics(const stats::RangeStatisticsIndex& index,
+                             const std::vector<float>& values, std::size_t begin,
+                             std::size_t end)
+{
+    stats::StatisticsAccumulator expected;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        expected.add(values[i]);
+    }
+
+    const stats::StatisticsAccumulator statistics = index.statistics(begin, end);
+
+    ASSERT_EQ(expected.count(), statistics.count()) << begin << " to " << end;
+    if (expected.count() == 0)
+    {
+        return;
+    }
+    EXPECT_EQ(expected.minimum(), statistics.minimum());
+    EXPECT_EQ(expected.maximum(), statistics.maximum());
+    EXPECT_NEAR(expected.mean(), statistics.mean(), 1.0e-5F);
+    EXPECT_NEAR(expected.absolute_mean(), statistics.absolute_mean(), 1.0e-5F);
+    EXPECT_NEAR(expected.standard_deviation(), statistics.standard_deviation(), 1.0e-5F);
+    if (expected.count() > 2)
+    {
+        EXPECT_NEAR(expected.skewness(), statistics.skewness(), 1.0e-4F);
+        EXPECT_NEAR(expected.kurtosis(), statistics.kurtosis(), 1.0e-4F);
+    }
+}
+
+} // unnamed namespace
+
+TEST(RangeStatisticsIndex, BehavesWellWithNoValues)
+{
+    stats::RangeStatisticsIndex index(nullptr, 0);
+
+    EXPECT_EQ(0U, index.size());
+    EXPECT_EQ(0U, index.number_of_blocks());
+    EXPECT_EQ(0U, index.statistics(0, 10).count());
+}
+
+TEST(RangeStatisticsIndex, AgreesWithDocumentedExample)
+{
+    const std::vector<float>& values = documented_test_set::values();
+    stats::RangeStatisticsIndex index(values.data(), values.size(), 8);
+
+    EXPECT_EQ(values.size(), index.size());
+    EXPECT_EQ(8U, index.block_size());
+    EXPECT_EQ((values.size() + 7) / 8, index.number_of_blocks());
+
+    const stats::StatisticsAccumulator statistics = index.statistics(0, values.size());
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_NEAR(documented_test_set::skewness(), statistics.skewness(), 1.0e-5F);
+    EXPECT_NEAR(documented_test_set::kurtosis(), statistics.kurtosis(), 1.0e-5F);
+}
+
+TEST(RangeStatisticsIndex, AgreesWithScansOfRanges)
+{
+    const std::vector<float> values = noisy_values(10007, -2.F);
+    stats::RangeStatisticsIndex index(values.data(), values.size(), 64);
+
+    // within a block, across one boundary, and across many blocks
+    expect_range_statistics(index, values, 10, 50);
+    expect_range_statistics(index, values, 60, 70);
+    expect_range_statistics(index, values, 64, 128);
+    expect_range_statistics(index, values, 0, values.size());
+    expect_range_statistics(index, values, 1, values.size() - 1);
+
+    std::uint32_t state = 99U;
+    for (std::size_t i = 0; i < 200; ++i)
+    {
+        state           = state * 1664525U + 1013904223U;
+        std::size_t one = (state >> 4U) % values.size();
+        state           = state * 1664525U + 1013904223U;
+        std::size_t two = (state >> 4U) % values.size();
+        expect_range_statistics(index, values, std::min(one, two), std::max(one, two));
+    }
+}
+
+TEST(RangeStatisticsIndex, ClipsRangesToTheArray)
+{
+    const std::vector<float> values = noisy_values(1000, -2.F);
+    stats::RangeStatisticsIndex index(values.data(), values.size(), 100);
+
+    EXPECT_EQ(100U, index.statistics(900, 5000).count());
+    EXPECT_EQ(0U, index.statistics(700, 600).count());
+    EXPECT_EQ(0U, index.statistics(2000, 3000).count());
+}
+
+TEST(RangeStatisticsIndex, BuildsTheSameIndexWithAnyThreads)
+{
+    const std::vector<float> values = noisy_values(50000, -2.F);
+    stats::RangeStatisticsIndex one_thread(values.data(), values.size(), 256, 1);
+    stats::RangeStatisticsIndex many_threads(values.data(), values.size(), 256, 7);
+
+    for (std::size_t begin = 0; begin < values.size(); begin += 4999)
+    {
+        const stats::StatisticsAccumulator one  = one_thread.statistics(begin, values.size());
+        const stats::StatisticsAccumulator many = many_threads.statistics(begin, values.size());
+        EXPECT_EQ(one.count(), many.count());
+        EXPECT_EQ(one.minimum(), many.minimum());
+        EXPECT_EQ(one.maximum(), many.maximum());
+        EXPECT_EQ(one.mean(), many.mean());
+        EXPECT_EQ(one.kurtosis(), many.kurtosis());
+    }
+}
@@ -0,0 +1,155 @@
+#include "stats/ReservoirSampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+std::vector<float> sequence(std::size_t number_of_values)
+{
+    std::vector<float> values(number_of_values);
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+        values[i] = static_cast<float>(i);
+    }
+    return values;
+}
+
+} // unnamed namespace
+
+TEST(ReservoirSampler, BehavesWellWithNoValues)
+{
+    stats::ReservoirSampler sampler(10);
+
+    EXPECT_EQ(0U, sampler.count());
+    EXPECT_EQ(10U, sampler.capacity());
+    EXPECT_TRUE(sampler.sample().empty());
+}
+
+TEST(ReservoirSampler, AgreesWithDocumentedExample)
+{
+    stats::ReservoirSampler sampler(1000);
+
+    sampler.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    // with fewer values than the capacity, the sample is every value
+    std::vector<float> sample = sampler.sample();
+    std::vector<float> values = documented_test_set::values();
+    std::sort(sample.begin(), sample.end());
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(documented_test_set::count(), sampler.count());
+    EXPECT_EQ(values, sample);
+}
+
+TEST(ReservoirSampler, KeepsFixedSizeSample)
+{
+    const std::vector<float> values = sequence(100000);
+    stats::ReservoirSampler sampler(500);
+
+    sampler.add(values.data(), values.size());
+
+    EXPECT_EQ(values.size(), sampler.count());
+    EXPECT_EQ(500U, sampler.sample().size());
+
+    std::vector<float> sample = sampler.sample();
+    std::sort(sample.begin(), sample.end());
+    EXPECT_EQ(sample.end(), std::adjacent_find(sample.begin(), sample.end()));
+}
+
+TEST(ReservoirSampler, SamplesUniformly)
+{
+    // Each of 10 equal parts of the stream should supply a tenth of the
+    // sampled values, over many samplers.
+    const std::size_t number_of_values = 20000;
+    const std::vector<float> values    = sequence(number_of_values);
+    std::vector<double> parts(10, 0.0);
+    for (std::uint64_t seed = 1; seed <= 200; ++seed)
+    {
+        stats::ReservoirSampler sampler(100, seed);
+        sampler.add(values.data(), values.size());
+        for (const float& value : sampler.sample())
+        {
+            parts[static_cast<std::size_t>(value) * 10 / number_of_values] += 1.0;
+        }
+    }
+
+    // 20000 sampled values, 2000 expected per part
+    for (const double& part : parts)
+    {
+        EXPECT_NEAR(2000.0, part, 4.0 * sqrt(2000.0));
+    }
+}
+
+TEST(ReservoirSampler, AddsArraysLikeSingleValues)
+{
+    const std::vector<float> values = sequence(50000);
+    stats::ReservoirSampler one_by_one(200, 7);
+    stats::ReservoirSampler arrays(200, 7);
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    for (std::size_t first = 0; first < values.size(); first += 3000)
+    {
+        arrays.add(values.data() + first, std::min<std::size_t>(3000, values.size() - first));
+    }
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.sample(), arrays.sample());
+}
+
+TEST(ReservoirSampler, CombinesInProportionToTheStreams)
+{
+    const std::vector<float> zeros(1000, 0.F);
+    const std::vector<float> ones(3000, 1.F);
+
+    double zeros_sampled = 0.0;
+    for (std::uint64_t seed = 1; seed <= 100; ++seed)
+    {
+        stats::ReservoirSampler first(400, seed);
+        stats::ReservoirSampler second(400, seed + 1000);
+        first.add(zeros.data(), zeros.size());
+        second.add(ones.data(), ones.size());
+
+        stats::ReservoirSampler combined = first + second;
+
+        EXPECT_EQ(4000U, combined.count());
+        ASSERT_EQ(400U, combined.sample().size());
+        zeros_sampled += static_cast<double>(
+            std::count(combined.sample().begin(), combined.sample().end(), 0.F));
+    }
+
+    // a quarter of the values are zeros, sd about 8 per combination
+    EXPECT_NEAR(100.0 * 100.0, zeros_sampled, 4.0 * 8.2 * sqrt(100.0));
+}
+
+TEST(ReservoirSampler, KeepsSamplingUniformlyAfterCombining)
+{
+    const std::vector<float> values = sequence(40000);
+    std::vector<double> halves(2, 0.0);
+    for (std::uint64_t seed = 1; seed <= 100; ++seed)
+    {
+        stats::ReservoirSampler first(100, seed);
+        stats::ReservoirSampler second(100, seed + 1000);
+        first.add(values.data(), 10000);
+        second.add(values.data() + 10000, 10000);
+
+        first += second;
+        first.add(values.data() + 20000, 20000);
+
+        for (const float& value : first.sample())
+        {
+            halves[value < 20000.F ? 0 : 1] += 1.0;
+        }
+    }
+
+    // 10000 sampled values, half from each half of the stream
+    EXPECT_NEAR(5000.0, halves[0], 4.0 * 50.0);
+    EXPECT_NEAR(5000.0, halves[1], 4.0 * 50.0);
+}
@@ -0,0 +1,152 @@
+#include "stats/RevisableStatisticsAccumulator.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+#include "test_data/NoisyValues.hpp"
+
+namespace // unnamed namespace
+{
+
+void expect_statistics(const std::vector<float>& values,
+                       const stats::RevisableStatisticsAccumulator& statistics)
+{
+    stats::StatisticsAccumulator expected;
+    for (const float& value : values)
+    {
+        expected.add(value);
+    }
+
+    ASSERT_EQ(expected.count(), statistics.count());
+    EXPECT_EQ(expected.minimum(), statistics.minimum());
+    EXPECT_EQ(expected.maximum(), statistics.maximum());
+    EXPECT_NEAR(expected.mean(), statistics.mean(), 1.0e-5F * expected.mean());
+    EXPECT_NEAR(expected.absolute_mean(), statistics.absolute_mean(),
+                1.0e-5F * expected.absolute_mean());
+    EXPECT_NEAR(expected.standard_deviation(), statistics.standard_deviation(),
+                1.0e-4F * expected.standard_deviation());
+    EXPECT_NEAR(expected.skewness(), statistics.skewness(), 1.0e-3F);
+    EXPECT_NEAR(expected.kurtosis(), statistics.kurtosis(), 1.0e-3F);
+}
+
+} // unnamed namespace
+
+TEST(RevisableStatisticsAccumulator, BehavesWellWithNoValues)
+{
+    stats::RevisableStatisticsAccumulator statistics;
+
+    EXPECT_TRUE(statistics.tracks_extremes());
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.minimum()));
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+    EXPECT_FALSE(statistics.remove(1.0F));
+    EXPECT_FALSE(statistics.replace(1.0F, 2.0F));
+    EXPECT_EQ(0U, statistics.count());
+}
+
+TEST(RevisableStatisticsAccumulator, AgreesWithDocumentedExample)
+{
+    stats::RevisableStatisticsAccumulator statistics;
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(RevisableStatisticsAccumulator, RemovesValues)
+{
+    std::vector<float> values = noisy_values(1000, 50.F);
+    stats::RevisableStatisticsAccumulator statistics;
+    for (const float& value : values)
+    {
+        statistics.add(value);
+    }
+
+    // remove the extremes and every other value
+    std::sort(values.begin(), values.end());
+    std::vector<float> kept;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i == 0 || i == values.size() - 1 || i % 2 == 1)
+        {
+            EXPECT_TRUE(statistics.remove(values[i]));
+        }
+        else
+        {
+            kept.push_back(values[i]);
+        }
+    }
+
+    expect_statistics(kept, statistics);
+}
+
+TEST(RevisableStatisticsAccumulator, ReplacesValues)
+{
+    std::vector<float> values = noisy_values(500, 50.F);
+    stats::RevisableStatisticsAccumulator statistics;
+    for (const float& value : values)
+    {
+        statistics.add(value);
+    }
+
+    for (std::size_t i = 0; i < values.size(); i += 3)
+    {
+        const float corrected = values[i] * 2.0F - 40.0F;
+        EXPECT_TRUE(statistics.replace(values[i], corrected));
+        values[i] = corrected;
+    }
+
+    expect_statistics(values, statistics);
+}
+
+TEST(RevisableStatisticsAccumulator, RefusesValuesNeverAdded)
+{
+    stats::RevisableStatisticsAccumulator statistics;
+    statistics.add(1.0F);
+    statistics.add(2.0F);
+    statistics.add(2.0F);
+
+    EXPECT_FALSE(statistics.remove(3.0F));
+    EXPECT_FALSE(statistics.replace(3.0F, 4.0F));
+    EXPECT_EQ(3U, statistics.count());
+    EXPECT_EQ(2.0F, statistics.maximum());
+
+    EXPECT_TRUE(statistics.remove(2.0F));
+    EXPECT_EQ(2.0F, statistics.maximum());
+    EXPECT_TRUE(statistics.remove(2.0F));
+    EXPECT_EQ(1.0F, statistics.maximum());
+    EXPECT_FALSE(statistics.remove(2.0F));
+
+    EXPECT_TRUE(statistics.remove(1.0F));
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+}
+
+TEST(RevisableStatisticsAccumulator, WorksWithoutExtremes)
+{
+    stats::RevisableStatisticsAccumulator statistics(false);
+
+    statistics.add(12.0F);
+    statistics.add(99.0F);
+    EXPECT_TRUE(statistics.replace(99.0F, 13.0F));
+
+    EXPECT_FALSE(statistics.tracks_extremes());
+    EXPECT_EQ(2U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.minimum()));
+    EXPECT_TRUE(stats::undefined(statistics.maximum()));
+    EXPECT_FLOAT_EQ(12.5F, statistics.mean());
+    EXPECT_FLOAT_EQ(0.5F, statistics.standard_deviation());
+}
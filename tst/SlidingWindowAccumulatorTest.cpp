@@ -0,0 +1,144 @@
+#include "stats/SlidingWindowAccumulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+#include "test_data/NoisyValues.hpp"
+
+namespace // unnamed namespace
+{
+
+void expect_window_statistics(const stats::SlidingWindowAccumulator& window,
+                              const float* last_values, std::size_t number_of_values)
+{
+    stats::StatisticsAccumulator expected;
+    for (std::size_t i = 0; i < number_of_values; ++i)
+    {
+        expected.add(last_values[i]);
+    }
+
+    ASSERT_EQ(expected.count(), window.count());
+    EXPECT_EQ(expected.minimum(), window.minimum());
+    EXPECT_EQ(expected.maximum(), window.maximum());
+    EXPECT_NEAR(expected.mean(), window.mean(), 1.0e-5F * std::fabs(expected.mean()));
+    EXPECT_NEAR(expected.absolute_mean(), window.absolute_mean(),
+                1.0e-5F * expected.absolute_mean());
+    EXPECT_NEAR(expected.standard_deviation(), window.standard_deviation(),
+                1.0e-3F * expected.standard_deviation());
+    EXPECT_NEAR(expected.skewness(), window.skewness(), 1.0e-2F);
+    EXPECT_NEAR(expected.kurtosis(), window.kurtosis(), 1.0e-2F);
+}
+
+} // unnamed namespace
+
+TEST(SlidingWindowAccumulator, BehavesWellWithNoValues)
+{
+    stats::SlidingWindowAccumulator window(10);
+
+    EXPECT_EQ(10U, window.window_size());
+    EXPECT_EQ(0U, window.count());
+    EXPECT_TRUE(stats::undefined(window.minimum()));
+    EXPECT_TRUE(stats::undefined(window.maximum()));
+    EXPECT_TRUE(stats::undefined(window.mean()));
+    EXPECT_TRUE(stats::undefined(window.kurtosis()));
+}
+
+TEST(SlidingWindowAccumulator, AgreesWithDocumentedExample)
+{
+    stats::SlidingWindowAccumulator window(1000);
+
+    for (const float& value : documented_test_set::values())
+    {
+        window.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), window.count());
+    EXPECT_EQ(documented_test_set::minimum(), window.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), window.maximum());
+    EXPECT_EQ(documented_test_set::mean(), window.mean());
+    EXPECT_EQ(documented_test_set::standard_deviation(), window.standard_deviation());
+    EXPECT_EQ(documented_test_set::skewness(), window.skewness());
+    EXPECT_EQ(documented_test_set::kurtosis(), window.kurtosis());
+}
+
+TEST(SlidingWindowAccumulator, TracksTheLastValues)
+{
+    const std::vector<float> values = noisy_values(5000, 0.F);
+    stats::SlidingWindowAccumulator window(37);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        window.add(values[i]);
+        const std::size_t count = std::min<std::size_t>(i + 1, 37);
+        expect_window_statistics(window, values.data() + i + 1 - count, count);
+    }
+}
+
+TEST(SlidingWindowAccumulator, StaysAccurateOverLongStreams)
+{
+    const std::vector<float> values = noisy_values(1000000, 10000.F);
+    stats::SlidingWindowAccumulator window(100);
+
+    for (const float& value : values)
+    {
+        window.add(value);
+    }
+
+    expect_window_statistics(window, values.data() + values.size() - 100, 100);
+}
+
+TEST(SlidingWindowAccumulator, ForgetsSpreadOfConstantWindows)
+{
+    stats::SlidingWindowAccumulator window(20);
+
+    const std::vector<float> values = noisy_values(100, 3.F);
+    window.add(values.data(), values.size());
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        window.add(0.1F);
+    }
+
+    EXPECT_EQ(0.1F, window.minimum());
+    EXPECT_EQ(0.1F, window.maximum());
+    EXPECT_EQ(0.F, window.standard_deviation());
+    EXPECT_TRUE(stats::undefined(window.skewness()));
+    EXPECT_TRUE(stats::undefined(window.kurtosis()));
+}
+
+TEST(SlidingWindowAccumulator, AddsArraysLikeSingleValues)
+{
+    const std::vector<float> values = noisy_values(1000, -5.F);
+    stats::SlidingWindowAccumulator one_by_one(64);
+    stats::SlidingWindowAccumulator arrays(64);
+
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), 30);
+    arrays.add(values.data() + 30, values.size() - 30);
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.minimum(), arrays.minimum());
+    EXPECT_EQ(one_by_one.maximum(), arrays.maximum());
+    EXPECT_FLOAT_EQ(one_by_one.mean(), arrays.mean());
+    EXPECT_FLOAT_EQ(one_by_one.standard_deviation(), arrays.standard_deviation());
+}
+
+TEST(SlidingWindowAccumulator, ProvidesWindowStatistics)
+{
+    const std::vector<float> values = noisy_values(300, 1.F);
+    stats::SlidingWindowAccumulator window(50);
+    window.add(values.data(), values.size());
+
+    stats::StatisticsAccumulator statistics = window.statistics();
+
+    EXPECT_EQ(50U, statistics.count());
+    EXPECT_EQ(window.minimum(), statistics.minimum());
+    EXPECT_EQ(window.maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(window.mean(), statistics.mean());
+}
@@ -0,0 +1,143 @@
+#include "stats/SlidingWindowQuantiles.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+#include "test_data/NoisyValues.hpp"
+
+namespace // unnamed namespace
+{
+
+// few distinct values, so the window holds many duplicates
+std::vector<float> repeating_values(std::size_t number_of_values)
+{
+    std::vector<float> values = noisy_values(number_of_values, -20.F);
+    for (float& value : values)
+    {
+        value = std::floor(value);
+    }
+    return values;
+}
+
+float expected_quantile(std::vector<float> values, const double& probability)
+{
+    std::sort(values.begin(), values.end());
+    const double position   = probability * static_cast<double>(values.size() - 1);
+    const std::size_t below = static_cast<std::size_t>(position);
+    const double fraction   = position - static_cast<double>(below);
+    if (fraction == 0.0)
+    {
+        return values[below];
+    }
+    const double lower = values[below];
+    const double upper = values[below + 1];
+    return static_cast<float>(lower + fraction * (upper - lower));
+}
+
+} // unnamed namespace
+
+TEST(SlidingWindowQuantiles, BehavesWellWithNoValues)
+{
+    stats::SlidingWindowQuantiles window(10);
+
+    EXPECT_EQ(10U, window.window_size());
+    EXPECT_EQ(0U, window.count());
+    EXPECT_TRUE(stats::undefined(window.median()));
+    EXPECT_TRUE(stats::undefined(window.quantile(0.95)));
+}
+
+TEST(SlidingWindowQuantiles, BehavesWellWithOneValue)
+{
+    stats::SlidingWindowQuantiles window(1);
+
+    window.add(3.F);
+    window.add(-7.F);
+
+    EXPECT_EQ(1U, window.count());
+    EXPECT_EQ(-7.F, window.median());
+    EXPECT_EQ(-7.F, window.quantile(0.0));
+    EXPECT_EQ(-7.F, window.quantile(1.0));
+}
+
+TEST(SlidingWindowQuantiles, AgreesWithDocumentedExample)
+{
+    stats::SlidingWindowQuantiles window(1000);
+
+    for (const float& value : documented_test_set::values())
+    {
+        window.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::count(), window.count());
+    EXPECT_EQ(documented_test_set::median(), window.median());
+    EXPECT_EQ(documented_test_set::minimum(), window.quantile(0.0));
+    EXPECT_EQ(documented_test_set::maximum(), window.quantile(1.0));
+}
+
+TEST(SlidingWindowQuantiles, TracksTheLastValues)
+{
+    const std::vector<float> values = repeating_values(3000);
+    stats::SlidingWindowQuantiles window(101);
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        window.add(values[i]);
+
+        const std::size_t count = std::min<std::size_t>(i + 1, 101);
+        const std::vector<float> last(values.begin() + (i + 1 - count), values.begin() + i + 1);
+        ASSERT_EQ(count, window.count());
+        for (const double& probability : {0.0, 0.05, 0.5, 0.95, 1.0})
+        {
+            ASSERT_EQ(expected_quantile(last, probability), window.quantile(probability))
+                << "value " << i << ", probability " << probability;
+        }
+    }
+}
+
+TEST(SlidingWindowQuantiles, AddsArraysLikeSingleValues)
+{
+    const std::vector<float> values = repeating_values(1000);
+    stats::SlidingWindowQuantiles one_by_one(64);
+    stats::SlidingWindowQuantiles arrays(64);
+
+    for (const float& value : values)
+    {
+        one_by_one.add(value);
+    }
+    arrays.add(values.data(), 30);
+    arrays.add(values.data() + 30, values.size() - 30);
+
+    EXPECT_EQ(one_by_one.count(), arrays.count());
+    EXPECT_EQ(one_by_one.median(), arrays.median());
+    EXPECT_EQ(one_by_one.quantile(0.95), arrays.quantile(0.95));
+}
+
+TEST(SlidingWindowQuantiles, OrdersSpecialValues)
+{
+    stats::SlidingWindowQuantiles window(5);
+
+    window.add(std::numeric_limits<float>::infinity());
+    window.add(-0.F);
+    window.add(-std::numeric_limits<float>::infinity());
+    window.add(0.F);
+    window.add(1.F);
+
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(), window.quantile(0.0));
+    EXPECT_EQ(0.F, window.median());
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), window.quantile(1.0));
+}
+
+TEST(SlidingWindowQuantiles, LeavesNanProbabilitiesUndefined)
+{
+    stats::SlidingWindowQuantiles window(10);
+    window.add(1.F);
+    window.add(2.F);
+
+    EXPECT_TRUE(stats::undefined(window.quantile(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_EQ(1.5F, window.median());
+}
@@ -0,0 +1,79 @@
+#include "stats/SnapshotStatisticsAccumulator.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(SnapshotStatisticsAccumulator, BehavesWellWithNoValues)
+{
+    stats::SnapshotStatisticsAccumulator shared;
+
+    stats::StatisticsAccumulator statistics = shared.snapshot();
+
+    EXPECT_EQ(0U, statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.mean()));
+}
+
+TEST(SnapshotStatisticsAccumulator, AgreesWithDocumentedExample)
+{
+    stats::SnapshotStatisticsAccumulator shared;
+
+    for (const float& value : documented_test_set::values())
+    {
+        shared.add(value);
+    }
+
+    stats::StatisticsAccumulator statistics = shared.snapshot();
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(SnapshotStatisticsAccumulator, ReadersNeverSeeTornSnapshots)
+{
+    // The writer adds 1, 2, 3, ... so every consistent snapshot has its
+    // maximum equal to its count.
+
+    stats::SnapshotStatisticsAccumulator shared;
+    const std::size_t number_of_values = 200000;
+    std::atomic<bool> done(false);
+
+    std::thread writer(
+        [&]()
+        {
+            for (std::size_t i = 1; i <= number_of_values; ++i)
+            {
+                shared.add(static_cast<float>(i));
+            }
+            done = true;
+        });
+
+    std::size_t torn = 0;
+    std::size_t last_count = 0;
+    while (!done)
+    {
+        stats::StatisticsAccumulator statistics = shared.snapshot();
+        if (statistics.count() == 0)
+        {
+            continue;
+        }
+        const float count = static_cast<float>(statistics.count());
+        if (statistics.maximum() != count || statistics.count() < last_count)
+        {
+            ++torn;
+        }
+        last_count = statistics.count();
+    }
+    writer.join();
+
+    EXPECT_EQ(0U, torn);
+    EXPECT_EQ(number_of_values, shared.snapshot().count());
+}
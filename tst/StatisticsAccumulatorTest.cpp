@@ -306,3 +306,180 @@ TEST(StatisticsAccumulator, IncrementsResultsFromAnotherAccumulator)
 
     test_equivalence(fullset, combined);
 }
+
+TEST(StatisticsAccumulator, SubtractsResultsOfAnotherAccumulator)
+{
+    stats::StatisticsAccumulator fullset;
+    stats::StatisticsAccumulator subset1;
+    stats::StatisticsAccumulator subset2;
+
+    int count = 0;
+    for (const float& value : documented_test_set::values())
+    {
+        fullset.add(value);
+        if ((++count % 3) == 0)
+        {
+            subset1.add(value);
+        }
+        else
+        {
+            subset2.add(value);
+        }
+    }
+
+    stats::StatisticsAccumulator difference = fullset - subset1;
+
+    EXPECT_EQ(subset2.count(), difference.count());
+    EXPECT_TRUE(stats::undefined(difference.minimum()));
+    EXPECT_TRUE(stats::undefined(difference.maximum()));
+    EXPECT_FLOAT_EQ(subset2.mean(), difference.mean());
+    EXPECT_FLOAT_EQ(subset2.absolute_mean(), difference.absolute_mean());
+    EXPECT_FLOAT_EQ(subset2.quadratic_mean(), difference.quadratic_mean());
+    EXPECT_FLOAT_EQ(subset2.standard_deviation(), difference.standard_deviation());
+    EXPECT_NEAR(subset2.skewness(), difference.skewness(), 1.0e-5F);
+    EXPECT_NEAR(subset2.kurtosis(), difference.kurtosis(), 1.0e-5F);
+
+    fullset -= subset2;
+    EXPECT_EQ(subset1.count(), fullset.count());
+    EXPECT_FLOAT_EQ(subset1.mean(), fullset.mean());
+    EXPECT_FLOAT_EQ(subset1.standard_deviation(), fullset.standard_deviation());
+
+    // the unknown extremes stay unknown when combined
+    EXPECT_TRUE(stats::undefined((difference + subset1).minimum()));
+}
+
+TEST(StatisticsAccumulator, SubtractsCumulativeSnapshots)
+{
+    stats::StatisticsAccumulator cumulative;
+    stats::StatisticsAccumulator expected;
+    stats::StatisticsAccumulator at_t1;
+
+    for (std::size_t i = 0; i < 3000; ++i)
+    {
+        const float value = static_cast<float>((i * 7919) % 1000) - 300.F;
+        cumulative.add(value);
+        if (i == 999)
+        {
+            at_t1 = cumulative;
+        }
+        else if (i > 999)
+        {
+            expected.add(value);
+        }
+    }
+
+    stats::StatisticsAccumulator between = cumulative - at_t1;
+
+    EXPECT_EQ(expected.count(), between.count());
+    EXPECT_NEAR(expected.mean(), between.mean(), 1.0e-4F);
+    EXPECT_NEAR(expected.standard_deviation(), between.standard_deviation(), 1.0e-3F);
+    EXPECT_NEAR(expected.skewness(), between.skewness(), 1.0e-4F);
+    EXPECT_NEAR(expected.kurtosis(), between.kurtosis(), 1.0e-4F);
+}
+
+TEST(StatisticsAccumulator, SubtractsEverythingToNoValues)
+{
+    stats::StatisticsAccumulator statistics;
+    statistics.add(1.0F);
+    statistics.add(2.0F);
+
+    stats::StatisticsAccumulator none;
+    EXPECT_EQ(2U, (statistics - none).count());
+    EXPECT_EQ(1.0F, (statistics - none).minimum());
+
+    stats::StatisticsAccumulator difference = statistics - statistics;
+    EXPECT_EQ(0U, difference.count());
+    EXPECT_TRUE(stats::undefined(difference.mean()));
+
+    difference.add(5.0F);
+    EXPECT_EQ(5.0F, difference.minimum());
+}
+
+TEST(StatisticsAccumulator, AddsArrayOfValues)
+{
+    stats::StatisticsAccumulator expected;
+    for (const float& value : documented_test_set::values())
+    {
+        expected.add(value);
+    }
+
+    stats::StatisticsAccumulator statistics;
+    statistics.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ(expected.count(), statistics.count());
+    EXPECT_EQ(expected.minimum(), statistics.minimum());
+    EXPECT_EQ(expected.maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(expected.mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(expected.absolute_mean(), statistics.absolute_mean());
+    EXPECT_FLOAT_EQ(expected.quadratic_mean(), statistics.quadratic_mean());
+    EXPECT_FLOAT_EQ(expected.standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(expected.skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(expected.kurtosis(), statistics.kurtosis());
+}
+
+TEST(StatisticsAccumulator, AddsArrayOfValuesSpanningSeveralBlocks)
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        values.push_back(static_cast<float>((i * 7919) % 1000) - 300.F);
+    }
+
+    stats::StatisticsAccumulator expected;
+    for (const float& value : values)
+    {
+        expected.add(value);
+    }
+
+    stats::StatisticsAccumulator statistics;
+    statistics.add(-1000.F);
+    expected.add(-1000.F);
+    statistics.add(values.data(), values.size());
+    statistics.add(values.data(), 0);
+
+    EXPECT_EQ(expected.count(), statistics.count());
+    EXPECT_EQ(expected.minimum(), statistics.minimum());
+    EXPECT_EQ(expected.maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(expected.mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(expected.absolute_mean(), statistics.absolute_mean());
+    EXPECT_FLOAT_EQ(expected.standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(expected.skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(expected.kurtosis(), statistics.kurtosis());
+}
+
+TEST(StatisticsAccumulator, RemovesValuesPreviouslyAdded)
+{
+    const std::vector<float> kept    = {3.F, -7.5F, 12.F, 0.25F, 9.F, -2.F};
+    const std::vector<float> removed = {100.F, -40.F, 6.5F};
+
+    stats::StatisticsAccumulator expected;
+    stats::StatisticsAccumulator statistics;
+    for (const float& value : kept)
+    {
+        expected.add(value);
+        statistics.add(value);
+    }
+    for (const float& value : removed)
+    {
+        statistics.add(value);
+    }
+    for (auto it = removed.rbegin(); it != removed.rend(); ++it)
+    {
+        statistics.remove(*it);
+    }
+
+    EXPECT_EQ(expected.count(), statistics.count());
+    EXPECT_TRUE(stats::undefined(statistics.minimum()));
+    EXPECT_TRUE(stats::undefined(statistics.maximum()));
+    EXPECT_FLOAT_EQ(expected.mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(expected.absolute_mean(), statistics.absolute_mean());
+    EXPECT_FLOAT_EQ(expected.standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(expected.skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(expected.kurtosis(), statistics.kurtosis());
+
+    for (const float& value : kept)
+    {
+        statistics.remove(value);
+    }
+    EXPECT_EQ(0U, statistics.count());
+}
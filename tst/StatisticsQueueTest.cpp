@@ -0,0 +1,117 @@
+#include "stats/StatisticsQueue.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "stats/StatisticsAccumulator.hpp"
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(StatisticsQueue, RoundsCapacityUpToPowerOfTwo)
+{
+    stats::StatisticsQueue queue(1000);
+
+    EXPECT_EQ(1024U, queue.capacity());
+    EXPECT_EQ(0U, queue.depth());
+    EXPECT_EQ(0U, queue.dropped());
+}
+
+TEST(StatisticsQueue, DrainsNothingWhenEmpty)
+{
+    stats::StatisticsQueue queue(16);
+    stats::StatisticsAccumulator statistics;
+
+    EXPECT_EQ(0U, queue.drain(statistics));
+    EXPECT_EQ(0U, statistics.count());
+}
+
+TEST(StatisticsQueue, AgreesWithDocumentedExample)
+{
+    stats::StatisticsQueue queue(256);
+
+    for (const float& value : documented_test_set::values())
+    {
+        EXPECT_TRUE(queue.push(value));
+    }
+    EXPECT_EQ(documented_test_set::count(), queue.depth());
+
+    stats::StatisticsAccumulator statistics;
+    EXPECT_EQ(documented_test_set::count(), queue.drain(statistics));
+    EXPECT_EQ(0U, queue.depth());
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(StatisticsQueue, DropsValuesWhenFull)
+{
+    stats::StatisticsQueue queue(4);
+    const std::vector<float> values = {1.F, 2.F, 3.F, 4.F, 5.F, 6.F};
+
+    EXPECT_EQ(4U, queue.push(values.data(), values.size()));
+    EXPECT_FALSE(queue.push(7.F));
+    EXPECT_EQ(3U, queue.dropped());
+    EXPECT_EQ(4U, queue.depth());
+
+    stats::StatisticsAccumulator statistics;
+    EXPECT_EQ(4U, queue.drain(statistics));
+    EXPECT_EQ(2.5F, statistics.mean());
+
+    EXPECT_TRUE(queue.push(8.F));
+    EXPECT_EQ(1U, queue.drain(statistics));
+    EXPECT_EQ(8.F, statistics.maximum());
+}
+
+TEST(StatisticsQueue, AccountsForEveryValueFromManyProducers)
+{
+    stats::StatisticsQueue queue(4096);
+    const std::size_t number_of_producers = 4;
+    const std::size_t values_per_producer = 100000;
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < number_of_producers; ++p)
+    {
+        producers.emplace_back(
+            [&queue, p]()
+            {
+                const std::vector<float> batch(8, 1.5F);
+                for (std::size_t i = 0; i < values_per_producer; i += batch.size())
+                {
+                    if (p % 2 == 0)
+                    {
+                        queue.push(batch.data(), batch.size());
+                    }
+                    else
+                    {
+                        for (const float& value : batch)
+                        {
+                            queue.push(value);
+                        }
+                    }
+                }
+            });
+    }
+
+    stats::StatisticsAccumulator statistics;
+    std::size_t drained = 0;
+    while (drained + queue.dropped() < number_of_producers * values_per_producer)
+    {
+        drained += queue.drain(statistics);
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    drained += queue.drain(statistics);
+
+    EXPECT_EQ(number_of_producers * values_per_producer, drained + queue.dropped());
+    EXPECT_EQ(drained, statistics.count());
+    EXPECT_EQ(1.5F, statistics.minimum());
+    EXPECT_EQ(1.5F, statistics.maximum());
+}
@@ -0,0 +1,138 @@
+#include "stats/StatisticsRegistry.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(StatisticsRegistry, BehavesWellWithNoValues)
+{
+    stats::StatisticsRegistry registry;
+
+    EXPECT_EQ(0U, registry.snapshot("unknown").count());
+    EXPECT_TRUE(registry.snapshot().empty());
+
+    registry.metric("latency");
+    EXPECT_EQ(0U, registry.snapshot("latency").count());
+    EXPECT_EQ(1U, registry.snapshot().size());
+}
+
+TEST(StatisticsRegistry, ReturnsTheSameIdForTheSameName)
+{
+    stats::StatisticsRegistry registry;
+
+    const std::size_t latency = registry.metric("latency");
+    const std::size_t size    = registry.metric("size");
+
+    EXPECT_NE(latency, size);
+    EXPECT_EQ(latency, registry.metric("latency"));
+}
+
+TEST(StatisticsRegistry, KeepsMetricsSeparate)
+{
+    stats::StatisticsRegistry registry;
+    const std::size_t latency = registry.metric("latency");
+    const std::size_t size    = registry.metric("size");
+
+    registry.record(latency, 1.F);
+    registry.record(latency, 3.F);
+    registry.record(size, 100.F);
+
+    EXPECT_EQ(2U, registry.snapshot("latency").count());
+    EXPECT_EQ(2.F, registry.snapshot("latency").mean());
+    EXPECT_EQ(1U, registry.snapshot("size").count());
+    EXPECT_EQ(100.F, registry.snapshot()["size"].mean());
+}
+
+TEST(StatisticsRegistry, IgnoresIdsNotFromMetric)
+{
+    stats::StatisticsRegistry registry;
+    const std::size_t latency = registry.metric("latency");
+
+    // the thread retires its accumulators when it exits
+    std::thread thread(
+        [&]()
+        {
+            registry.record(latency + 1, 1.F);
+            registry.record(latency + 1000, 2.F);
+            registry.record(latency, 3.F);
+        });
+    thread.join();
+
+    EXPECT_EQ(1U, registry.snapshot("latency").count());
+    EXPECT_EQ(1U, registry.snapshot().size());
+}
+
+TEST(StatisticsRegistry, CombinesExitedAndLiveThreads)
+{
+    stats::StatisticsRegistry registry;
+    const std::size_t metric         = registry.metric("documented");
+    const std::vector<float>& values = documented_test_set::values();
+
+    std::vector<std::thread> workers;
+    for (std::size_t w = 0; w < 3; ++w)
+    {
+        workers.emplace_back(
+            [&, w]()
+            {
+                for (std::size_t i = w; i < values.size(); i += 4)
+                {
+                    registry.record(metric, values[i]);
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    for (std::size_t i = 3; i < values.size(); i += 4)
+    {
+        registry.record(metric, values[i]);
+    }
+
+    stats::StatisticsAccumulator statistics = registry.snapshot("documented");
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_FLOAT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_FLOAT_EQ(documented_test_set::standard_deviation(), statistics.standard_deviation());
+    EXPECT_FLOAT_EQ(documented_test_set::skewness(), statistics.skewness());
+    EXPECT_FLOAT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(StatisticsRegistry, SnapshotsWhileThreadsRecord)
+{
+    stats::StatisticsRegistry registry;
+    const std::size_t metric           = registry.metric("busy");
+    const std::size_t number_of_values = 50000;
+
+    std::vector<std::thread> workers;
+    for (std::size_t w = 0; w < 4; ++w)
+    {
+        workers.emplace_back(
+            [&]()
+            {
+                for (std::size_t i = 0; i < number_of_values; ++i)
+                {
+                    registry.record(metric, 1.F);
+                }
+            });
+    }
+
+    std::size_t last_count = 0;
+    while (last_count < 4 * number_of_values)
+    {
+        stats::StatisticsAccumulator statistics = registry.snapshot("busy");
+        EXPECT_LE(last_count, statistics.count());
+        last_count = statistics.count();
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(4 * number_of_values, registry.snapshot("busy").count());
+}
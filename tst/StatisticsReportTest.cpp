@@ -2,7 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include "stats/DecayedHistogram.hpp"
+#include "stats/ExponentialStatisticsAccumulator.hpp"
+#include "stats/HistogramAccumulator.hpp"
+#include "stats/LogLinearHistogram.hpp"
+#include "stats/P2QuantileEstimator.hpp"
+#include "stats/SlidingWindowAccumulator.hpp"
+#include "stats/SlidingWindowQuantiles.hpp"
 #include "stats/StatisticsAccumulator.hpp"
+#include "stats/TDigest.hpp"
 #include "test_data/DocumentedTestSet.hpp"
 
 TEST(StatisticsReport, BehavesWellWithNoValues)
@@ -36,6 +44,38 @@ TEST(StatisticsReport, BehavesWellWithConstantValues)
               stats::description(statistics));
 }
 
+TEST(StatisticsReport, DescribesExponentialStatistics)
+{
+    stats::ExponentialStatisticsAccumulator statistics(5.0);
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        statistics.add(2);
+    }
+
+    EXPECT_EQ("10 Values\n Minimum  = 2\n Maximum  = 2\n Mean     = 2\n Abs.Mean = 2\n Rms      = "
+              "2\n Std.Devn = 0",
+              stats::description(statistics));
+}
+
+TEST(StatisticsReport, OmitsUnknownExtremes)
+{
+    stats::StatisticsAccumulator statistics;
+    stats::StatisticsAccumulator earlier;
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        statistics.add(2);
+        if (i < 4)
+        {
+            earlier.add(2);
+        }
+    }
+
+    EXPECT_EQ("6 Values\n Mean     = 2\n Abs.Mean = 2\n Rms      = 2\n Std.Devn = 0",
+              stats::description(statistics - earlier));
+}
+
 TEST(StatisticsReport, AgreesWithDocumentedExample)
 {
     stats::StatisticsAccumulator statistics;
@@ -47,3 +87,117 @@ TEST(StatisticsReport, AgreesWithDocumentedExample)
 
     EXPECT_EQ(documented_test_set::statistics_description(), stats::description(statistics));
 }
+
+TEST(StatisticsReport, IncludesAvailableMedian)
+{
+    stats::StatisticsAccumulator statistics;
+    stats::P2QuantileEstimator quantiles;
+
+    EXPECT_EQ("No Values", stats::description(statistics, quantiles));
+
+    for (const float value : {3.F, 1.F, 2.F})
+    {
+        statistics.add(value);
+        quantiles.add(value);
+    }
+
+    EXPECT_EQ("3 Values\n Minimum  = 1\n Maximum  = 3\n Median   = 2\n Mean     = 2\n Abs.Mean = "
+              "2\n Rms      = 2.16025\n Std.Devn = 0.816497\n Skewness = 0\n Kurtosis = -1.5",
+              stats::description(statistics, quantiles));
+}
+
+TEST(StatisticsReport, OmitsUnavailableMedian)
+{
+    stats::StatisticsAccumulator statistics;
+    stats::P2QuantileEstimator quantiles({0.9F});
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+        quantiles.add(value);
+    }
+
+    EXPECT_EQ(documented_test_set::statistics_description(),
+              stats::description(statistics, quantiles));
+}
+
+TEST(StatisticsReport, IncludesDigestPercentiles)
+{
+    stats::StatisticsAccumulator statistics;
+    stats::TDigest digest;
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+        digest.add(value);
+    }
+
+    EXPECT_EQ("100 Values\n Minimum  = 61\n Maximum  = 73\n Median   = 67\n P90      = 70\n P99 "
+              "     = 73\n P99.9    = 73\n Mean     = 67.45\n Abs.Mean = 67.45\n Rms      = "
+              "67.5132\n Std.Devn = 2.92019\n Skewness = -0.108154\n Kurtosis = -0.258241",
+              stats::description(statistics, digest));
+}
+
+TEST(StatisticsReport, IncludesHistogramPercentiles)
+{
+    stats::StatisticsAccumulator statistics;
+    stats::LogLinearHistogram histogram(1.F, 1000.F, 10);
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+        histogram.record(value);
+    }
+
+    EXPECT_EQ("100 Values\n Minimum  = 61\n Maximum  = 73\n Median   = 67.0312\n P90      = "
+              "70.0312\n P99      = 73\n P99.9    = 73\n Mean     = 67.45\n Abs.Mean = 67.45\n "
+              "Rms      = 67.5132\n Std.Devn = 2.92019\n Skewness = -0.108154\n Kurtosis = "
+              "-0.258241",
+              stats::description(statistics, histogram));
+}
+
+TEST(StatisticsReport, IncludesWindowPercentiles)
+{
+    stats::SlidingWindowAccumulator statistics(3);
+    stats::SlidingWindowQuantiles quantiles(3);
+
+    for (const float& value : {1.F, 2.F, 3.F})
+    {
+        statistics.add(value);
+        quantiles.add(value);
+    }
+
+    EXPECT_EQ("3 Values\n Minimum  = 1\n Maximum  = 3\n Median   = 2\n P90      = 2.8\n P99 "
+              "     = 2.98\n P99.9    = 2.998\n Mean     = 2\n Abs.Mean = 2\n Rms      = "
+              "2.16025\n Std.Devn = 0.816497\n Skewness = 0\n Kurtosis = -1.5",
+              stats::description(statistics, quantiles));
+}
+
+TEST(StatisticsReport, IncludesDecayedPercentiles)
+{
+    stats::ExponentialStatisticsAccumulator statistics(1.0e12);
+    stats::DecayedHistogram histogram(1.0e12, 1.0F, 1000.0F);
+
+    for (const float& value : documented_test_set::values())
+    {
+        statistics.add(value);
+        histogram.record(statistics.time(), value);
+    }
+
+    EXPECT_EQ("100 Values\n Minimum  = 61\n Maximum  = 73\n Median   = 67.25\n P90      = 70.25\n "
+              "P99      = 73\n P99.9    = 73\n Mean     = 67.45\n Abs.Mean = 67.45\n Rms      = "
+              "67.5132\n Std.Devn = 2.92019\n Skewness = -0.108154\n Kurtosis = -0.258241",
+              stats::description(statistics, histogram));
+}
+
+TEST(StatisticsReport, DescribesHistogramBins)
+{
+    stats::HistogramAccumulator histogram(60.F, 72.F, 3);
+
+    EXPECT_EQ("No Values", stats::description(histogram));
+
+    histogram.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ("100 Values\n [60, 64) = 5\n [64, 68) = 60\n [68, 72) = 27\n Overflow  = 8",
+              stats::description(histogram));
+}
@@ -21,3 +21,10 @@ TEST(StatisticsReportsHelpers, LabelAndValueHasSixSignificantDigits)
 {
     EXPECT_EQ(" Value = 6.54321", stats::detail::label_and_value(" Value = ", 6.5432123456));
 }
+
+TEST(StatisticsReportsHelpers, PercentileLabelMatchesOtherLabels)
+{
+    EXPECT_EQ(" P90      = ", stats::detail::percentile_label(90.F));
+    EXPECT_EQ(" P99.9    = ", stats::detail::percentile_label(99.9F));
+    EXPECT_EQ(stats::detail::kMedianLabel.size(), stats::detail::percentile_label(99.99F).size());
+}
@@ -0,0 +1,209 @@
+#include "stats/StatisticsRollup.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace // unnamed namespace
+{
+
+// One value per second from the start, the value being the second modulo 100.
+void add_seconds(stats::StatisticsRollup& rollup, const std::int64_t& start,
+                 const std::int64_t& end)
+{
+    for (std::int64_t second = start; second < end; ++second)
+    {
+        rollup.add(second, static_cast<float>(second % 100));
+    }
+}
+
+stats::StatisticsAccumulator expected_seconds(const std::int64_t& start, const std::int64_t& end)
+{
+    stats::StatisticsAccumulator statistics;
+    for (std::int64_t second = start; second < end; ++second)
+    {
+        statistics.add(static_cast<float>(second % 100));
+    }
+    return statistics;
+}
+
+void expect_same_statistics(const stats::StatisticsAccumulator& expected,
+                            const stats::StatisticsAccumulator& actual)
+{
+    ASSERT_EQ(expected.count(), actual.count());
+    EXPECT_EQ(expected.minimum(), actual.minimum());
+    EXPECT_EQ(expected.maximum(), actual.maximum());
+    EXPECT_FLOAT_EQ(expected.mean(), actual.mean());
+    EXPECT_FLOAT_EQ(expected.standard_deviation(), actual.standard_deviation());
+}
+
+} // unnamed namespace
+
+TEST(StatisticsRollup, BehavesWellWithNoValues)
+{
+    stats::StatisticsRollup rollup;
+
+    EXPECT_EQ(1, rollup.width(0));
+    EXPECT_EQ(10, rollup.width(1));
+    EXPECT_EQ(60, rollup.width(2));
+    EXPECT_EQ(600, rollup.width(3));
+    EXPECT_EQ(3600, rollup.width(4));
+    EXPECT_EQ(21600, rollup.width(5));
+    EXPECT_EQ(86400, rollup.width(6));
+    EXPECT_EQ(0U, rollup.size(0));
+    EXPECT_EQ(0U, rollup.range(0, 86400).count());
+    EXPECT_EQ(0U, rollup.number_of_nodes(0, 86400));
+}
+
+TEST(StatisticsRollup, AgreesWithDocumentedExample)
+{
+    stats::StatisticsRollup rollup;
+
+    std::int64_t second = 1000;
+    for (const float& value : documented_test_set::values())
+    {
+        rollup.add(second / 7, value);
+        ++second;
+    }
+
+    const stats::StatisticsAccumulator statistics = rollup.range(0, 86400);
+
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::minimum(), statistics.minimum());
+    EXPECT_EQ(documented_test_set::maximum(), statistics.maximum());
+    EXPECT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_NEAR(documented_test_set::standard_deviation(), statistics.standard_deviation(),
+                1.0e-5F);
+}
+
+TEST(StatisticsRollup, RollsCompletedSecondsUpward)
+{
+    stats::StatisticsRollup rollup;
+
+    add_seconds(rollup, 0, 7200);
+
+    // the older seconds have expired
+    EXPECT_EQ(3600U, rollup.size(0));
+    EXPECT_EQ(360U, rollup.size(1));
+    EXPECT_EQ(120U, rollup.size(2));
+    EXPECT_EQ(12U, rollup.size(3));
+    EXPECT_EQ(2U, rollup.size(4));
+    EXPECT_EQ(1U, rollup.size(5));
+    EXPECT_EQ(1U, rollup.size(6));
+    expect_same_statistics(expected_seconds(0, 7200), rollup.range(0, 7200));
+}
+
+TEST(StatisticsRollup, MergesTheFewestNodes)
+{
+    stats::StatisticsRollup rollup(100000, 1500, 30, 2);
+
+    add_seconds(rollup, 0, 86400 + 100);
+
+    EXPECT_EQ(1U, rollup.number_of_nodes(0, 86400));
+    EXPECT_EQ(1U, rollup.number_of_nodes(3600, 7200));
+    expect_same_statistics(expected_seconds(3600, 7200), rollup.range(3600, 7200));
+
+    // 9 minutes, 5 ten minutes, 1 hour, then 2 minutes and 5 seconds
+    EXPECT_EQ(22U, rollup.number_of_nodes(3600 - 3540, 7200 + 125));
+    expect_same_statistics(expected_seconds(60, 7325), rollup.range(60, 7325));
+
+    // 5 seconds, 9 minutes, 5 ten minutes, 5 hours, 2 six hours, then back
+    // down through 5 hours, 5 ten minutes, 9 minutes and 5 seconds
+    EXPECT_EQ(50U, rollup.number_of_nodes(55, 86400 - 55));
+    expect_same_statistics(expected_seconds(55, 86345), rollup.range(55, 86345));
+
+    // the gathering second is included
+    expect_same_statistics(expected_seconds(86400, 86500), rollup.range(86400, 86500));
+}
+
+TEST(StatisticsRollup, AcceptsPerSecondStatistics)
+{
+    stats::StatisticsRollup rollup;
+
+    stats::StatisticsAccumulator second;
+    second.add(1.0F);
+    second.add(3.0F);
+
+    rollup.add(100, second);
+    rollup.add(100, second);
+    rollup.add(200, second);
+
+    EXPECT_EQ(4U, rollup.range(100, 101).count());
+    EXPECT_EQ(6U, rollup.range(0, 3600).count());
+    EXPECT_EQ(2.0F, rollup.range(0, 3600).mean());
+}
+
+TEST(StatisticsRollup, KeepsBoundedRetention)
+{
+    stats::StatisticsRollup rollup(60, 60, 24, 7);
+
+    add_seconds(rollup, 0, 3 * 3600 + 1);
+
+    EXPECT_EQ(60U, rollup.size(0));
+    EXPECT_EQ(6U, rollup.size(1));
+    EXPECT_EQ(60U, rollup.size(2));
+    EXPECT_EQ(6U, rollup.size(3));
+    EXPECT_EQ(3U, rollup.size(4));
+    EXPECT_EQ(1U, rollup.size(5));
+    EXPECT_EQ(1U, rollup.size(6));
+
+    // whole expired minutes and seconds come from the coarser levels, and the
+    // unaligned part of an expired hour is left out
+    expect_same_statistics(expected_seconds(3600, 3 * 3600), rollup.range(3600, 3 * 3600));
+    expect_same_statistics(expected_seconds(7200, 3 * 3600), rollup.range(5000, 3 * 3600));
+}
+
+TEST(StatisticsRollup, AcceptsLateSeconds)
+{
+    stats::StatisticsRollup rollup;
+
+    add_seconds(rollup, 0, 600);
+    rollup.add(30, 1000.0F);
+    rollup.add(601, 0.0F);
+
+    EXPECT_EQ(1000.0F, rollup.range(0, 60).maximum());
+    EXPECT_EQ(602U, rollup.range(0, 3600).count());
+}
+
+TEST(StatisticsRollup, WalksOnlyTheRetainedSeconds)
+{
+    stats::StatisticsRollup rollup(60, 60, 24, 7);
+
+    add_seconds(rollup, 1700000000, 1700010000);
+
+    const std::int64_t lowest  = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t highest = std::numeric_limits<std::int64_t>::max();
+    // the whole day node holds every second added
+    EXPECT_EQ(10000U, rollup.range(lowest, highest).count());
+    EXPECT_EQ(0U, rollup.range(1800000000, highest).count());
+    EXPECT_EQ(0U, rollup.range(lowest, 1600000000).count());
+}
+
+TEST(StatisticsRollup, BoundsTheNodesOfUnalignedRanges)
+{
+    stats::StatisticsRollup rollup(3 * 86400, 3 * 1440, 72, 3);
+
+    const std::int64_t day = 19675 * 86400;
+    add_seconds(rollup, day - 86400, day + 2 * 86400);
+
+    // 9 seconds, 5 ten seconds, 9 minutes, 5 ten minutes, 5 hours and 3 six
+    // hours at each end of a whole day
+    const std::int64_t apart = 86400 - 1;
+    EXPECT_EQ(2U * (9U + 5U + 9U + 5U + 5U + 3U) + 1U,
+              rollup.number_of_nodes(day - apart, day + 86400 + apart));
+    expect_same_statistics(expected_seconds(day - apart, day + 86400 + apart),
+                           rollup.range(day - apart, day + 86400 + apart));
+
+    EXPECT_EQ(1U, rollup.number_of_nodes(day, day + 86400));
+
+    // any hour, at every alignment within a day
+    std::size_t most = 0;
+    for (std::int64_t start = day; start < day + 86400; ++start)
+    {
+        most = std::max(most, rollup.number_of_nodes(start, start + 3600));
+    }
+    EXPECT_EQ(29U, most);
+}
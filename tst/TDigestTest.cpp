@@ -0,0 +1,217 @@
+#include "stats/TDigest.hpp"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+namespace
+{ // unnamed namespace
+
+// A permutation of 0 ... 100002, so the p-quantile is close to p * 100002.
+std::vector<float> uniform_values()
+{
+    std::vector<float> values;
+    for (std::size_t i = 0; i < 100003; ++i)
+    {
+        values.push_back(static_cast<float>((i * 7919) % 100003));
+    }
+    return values;
+}
+
+} // unnamed namespace
+
+TEST(TDigest, BehavesWellWithNoValues)
+{
+    stats::TDigest digest;
+
+    EXPECT_EQ(0U, digest.count());
+    EXPECT_EQ(0U, digest.size());
+    EXPECT_TRUE(stats::undefined(digest.quantile(0.5)));
+}
+
+TEST(TDigest, BehavesWellWithOneValue)
+{
+    stats::TDigest digest;
+
+    digest.add(123.4F);
+
+    EXPECT_EQ(1U, digest.count());
+    EXPECT_EQ(123.4F, digest.quantile(0.0));
+    EXPECT_EQ(123.4F, digest.quantile(0.5));
+    EXPECT_EQ(123.4F, digest.quantile(1.0));
+}
+
+TEST(TDigest, IsExactForFewValues)
+{
+    stats::TDigest digest;
+
+    digest.add(3.F);
+    digest.add(1.F);
+    digest.add(2.F);
+
+    EXPECT_EQ(1.F, digest.quantile(0.0));
+    EXPECT_EQ(2.F, digest.quantile(0.5));
+    EXPECT_EQ(3.F, digest.quantile(1.0));
+}
+
+TEST(TDigest, AgreesWithDocumentedExample)
+{
+    stats::TDigest digest;
+
+    digest.add(documented_test_set::values().data(), documented_test_set::values().size());
+
+    EXPECT_EQ(documented_test_set::count(), digest.count());
+    EXPECT_EQ(documented_test_set::minimum(), digest.quantile(0.0));
+    EXPECT_EQ(documented_test_set::maximum(), digest.quantile(1.0));
+    EXPECT_EQ(documented_test_set::median(), digest.quantile(0.5));
+}
+
+TEST(TDigest, EstimatesTailQuantilesOfUniformValues)
+{
+    stats::TDigest digest;
+    const std::vector<float> values = uniform_values();
+
+    for (const float& value : values)
+    {
+        digest.add(value);
+    }
+
+    EXPECT_LE(digest.size(), 100U);
+    EXPECT_NEAR(50001.F, digest.quantile(0.5), 500.F);
+    EXPECT_NEAR(90002.F, digest.quantile(0.9), 200.F);
+    EXPECT_NEAR(99003.F, digest.quantile(0.99), 50.F);
+    EXPECT_NEAR(99903.F, digest.quantile(0.999), 20.F);
+}
+
+TEST(TDigest, CombinesResultsFromMultipleDigests)
+{
+    const std::vector<float> values = uniform_values();
+    const std::size_t half          = values.size() / 2;
+
+    stats::TDigest digest1, digest2, empty;
+    digest1.add(values.data(), half);
+    digest2.add(values.data() + half, values.size() - half);
+
+    stats::TDigest combined = digest1 + empty + digest2;
+    EXPECT_EQ(values.size(), combined.count());
+    EXPECT_EQ(0.F, combined.quantile(0.0));
+    EXPECT_EQ(100002.F, combined.quantile(1.0));
+    EXPECT_NEAR(50001.F, combined.quantile(0.5), 500.F);
+    EXPECT_NEAR(99003.F, combined.quantile(0.99), 50.F);
+
+    stats::TDigest incremented;
+    incremented += digest1;
+    incremented += digest2;
+    EXPECT_EQ(combined.quantile(0.99), incremented.quantile(0.99));
+}
+
+TEST(TDigest, RoundTripsThroughSerialization)
+{
+    const std::vector<float> values = uniform_values();
+    stats::TDigest digest;
+    digest.add(values.data(), values.size());
+
+    const std::string bytes = digest.serialize();
+    EXPECT_LT(bytes.size(), 8 * digest.size() + 32);
+
+    stats::TDigest restored;
+    ASSERT_TRUE(restored.deserialize(bytes));
+    EXPECT_EQ(digest.count(), restored.count());
+    EXPECT_EQ(digest.size(), restored.size());
+    EXPECT_NEAR(digest.quantile(0.5), restored.quantile(0.5), 0.01F);
+    EXPECT_NEAR(digest.quantile(0.999), restored.quantile(0.999), 0.01F);
+}
+
+TEST(TDigest, RejectsInvalidSerialization)
+{
+    stats::TDigest digest;
+    digest.add(1.F);
+    const std::string bytes = digest.serialize();
+
+    stats::TDigest restored;
+    EXPECT_FALSE(restored.deserialize(""));
+    EXPECT_FALSE(restored.deserialize("garbage"));
+    EXPECT_FALSE(restored.deserialize(bytes.substr(0, bytes.size() - 1)));
+    EXPECT_FALSE(restored.deserialize(bytes + "x"));
+
+    // the compression follows the version byte
+    for (const double compression : {std::numeric_limits<double>::infinity(),
+                                     std::numeric_limits<double>::quiet_NaN(), 1e300})
+    {
+        std::string tampered = bytes;
+        memcpy(&tampered[1], &compression, sizeof(compression));
+        EXPECT_FALSE(restored.deserialize(tampered));
+    }
+    EXPECT_EQ(0U, restored.count());
+}
+
+TEST(TDigest, RejectsCentroidsQuantileCannotUse)
+{
+    stats::TDigest digest;
+    digest.add(1.F);
+    digest.add(2.F);
+    const std::string bytes = digest.serialize();
+
+    // version, compression, extremes and size, then each mean and weight
+    const std::size_t first_mean = 1 + sizeof(double) + 2 * sizeof(float) + 1;
+    const float infinity         = std::numeric_limits<float>::infinity();
+    for (const float mean : {std::numeric_limits<float>::quiet_NaN(), infinity, 0.5F, 2.5F})
+    {
+        std::string tampered = bytes;
+        memcpy(&tampered[first_mean], &mean, sizeof(mean));
+        stats::TDigest restored;
+        EXPECT_FALSE(restored.deserialize(tampered));
+    }
+
+    // two weights of 2^64 - 1 wrap the count
+    std::string wrapping = bytes.substr(0, first_mean);
+    for (const float mean : {1.F, 2.F})
+    {
+        wrapping.append(reinterpret_cast<const char*>(&mean), sizeof(mean));
+        wrapping.append(9, static_cast<char>(0xff));
+        wrapping.push_back(1);
+    }
+    stats::TDigest restored;
+    EXPECT_FALSE(restored.deserialize(wrapping));
+    EXPECT_EQ(0U, restored.count());
+}
+
+TEST(TDigest, ReadsBufferedValuesWithoutChangingTheDigest)
+{
+    stats::TDigest digest;
+    for (const float& value : documented_test_set::values())
+    {
+        digest.add(value);
+    }
+
+    // a const digest merges its buffer in a copy for each read
+    const stats::TDigest& shared = digest;
+    const std::string bytes      = shared.serialize();
+    EXPECT_EQ(documented_test_set::median(), shared.quantile(0.5));
+    EXPECT_EQ(bytes, shared.serialize());
+
+    stats::TDigest restored;
+    ASSERT_TRUE(restored.deserialize(bytes));
+    EXPECT_EQ(shared.size(), restored.size());
+    EXPECT_EQ(shared.quantile(0.5), restored.quantile(0.5));
+}
+
+TEST(TDigest, ClampsTheCompression)
+{
+    for (const double compression : {std::numeric_limits<double>::infinity(),
+                                     std::numeric_limits<double>::quiet_NaN(), 1e300, -5.0})
+    {
+        stats::TDigest digest(compression);
+        for (const float& value : documented_test_set::values())
+        {
+            digest.add(value);
+        }
+        EXPECT_EQ(documented_test_set::count(), digest.count());
+        EXPECT_EQ(documented_test_set::minimum(), digest.quantile(0.0));
+        EXPECT_EQ(documented_test_set::maximum(), digest.quantile(1.0));
+    }
+}
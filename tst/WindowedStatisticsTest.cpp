@@ -0,0 +1,171 @@
+#include "stats/WindowedStatistics.hpp"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "stats/StatisticsUtilities.hpp"
+#include "test_data/DocumentedTestSet.hpp"
+
+TEST(WindowedStatistics, BehavesWellWithNoValues)
+{
+    stats::WindowedStatistics windows(1000, 60);
+
+    EXPECT_EQ(1000, windows.bucket_width());
+    EXPECT_EQ(0U, windows.late());
+    EXPECT_FALSE(windows.sealed(0));
+    EXPECT_EQ(0U, windows.bucket(0).count());
+    EXPECT_EQ(0U, windows.window(0, 60000).count());
+}
+
+TEST(WindowedStatistics, AgreesWithDocumentedExample)
+{
+    stats::WindowedStatistics windows(1000, 60);
+
+    std::int64_t timestamp = 5000;
+    for (const float& value : documented_test_set::values())
+    {
+        windows.add(timestamp, value);
+        timestamp += 3;
+    }
+
+    const stats::StatisticsAccumulator statistics = windows.bucket(5500);
+    EXPECT_EQ(documented_test_set::count(), statistics.count());
+    EXPECT_EQ(documented_test_set::mean(), statistics.mean());
+    EXPECT_EQ(documented_test_set::kurtosis(), statistics.kurtosis());
+}
+
+TEST(WindowedStatistics, SplitsValuesInToBuckets)
+{
+    stats::WindowedStatistics windows(10, 8);
+
+    for (std::int64_t timestamp = 0; timestamp < 40; ++timestamp)
+    {
+        EXPECT_TRUE(windows.add(timestamp, static_cast<float>(timestamp / 10)));
+    }
+
+    for (std::int64_t bucket = 0; bucket < 4; ++bucket)
+    {
+        const stats::StatisticsAccumulator statistics = windows.bucket(bucket * 10 + 5);
+        EXPECT_EQ(10U, statistics.count());
+        EXPECT_EQ(static_cast<float>(bucket), statistics.minimum());
+        EXPECT_EQ(static_cast<float>(bucket), statistics.maximum());
+    }
+    EXPECT_EQ(0U, windows.bucket(45).count());
+}
+
+TEST(WindowedStatistics, HandlesNegativeTimestamps)
+{
+    stats::WindowedStatistics windows(10, 8);
+
+    windows.add(-11, 1.F);
+    windows.add(-10, 2.F);
+    windows.add(-1, 3.F);
+
+    EXPECT_EQ(1U, windows.bucket(-20).count());
+    EXPECT_EQ(2U, windows.bucket(-10).count());
+}
+
+TEST(WindowedStatistics, CombinesBucketsInToHoppingWindows)
+{
+    stats::WindowedStatistics windows(10, 100);
+    std::vector<float> values;
+    for (std::int64_t timestamp = 0; timestamp < 500; ++timestamp)
+    {
+        const float value = static_cast<float>((timestamp * 37) % 101);
+        windows.add(timestamp, value);
+        values.push_back(value);
+    }
+
+    // 100 tick windows hopping every 50 ticks
+    for (std::int64_t start = 0; start + 100 <= 500; start += 50)
+    {
+        stats::StatisticsAccumulator expected;
+        for (std::int64_t timestamp = start; timestamp < start + 100; ++timestamp)
+        {
+            expected.add(values[static_cast<std::size_t>(timestamp)]);
+        }
+
+        const stats::StatisticsAccumulator window = windows.window(start, start + 100);
+        EXPECT_EQ(expected.count(), window.count());
+        EXPECT_EQ(expected.minimum(), window.minimum());
+        EXPECT_EQ(expected.maximum(), window.maximum());
+        EXPECT_FLOAT_EQ(expected.mean(), window.mean());
+        EXPECT_FLOAT_EQ(expected.standard_deviation(), window.standard_deviation());
+    }
+}
+
+TEST(WindowedStatistics, AcceptsValuesWithinTheAllowedLateness)
+{
+    stats::WindowedStatistics windows(10, 8, 5);
+
+    EXPECT_TRUE(windows.add(12, 1.F));
+    EXPECT_TRUE(windows.add(14, 1.F));
+    EXPECT_TRUE(windows.add(9, 1.F)); // watermark 9, bucket 0 to 10 still open
+    EXPECT_FALSE(windows.sealed(10));
+
+    EXPECT_TRUE(windows.add(15, 1.F)); // watermark 10 seals bucket 0 to 10
+    EXPECT_TRUE(windows.sealed(10));
+    EXPECT_FALSE(windows.sealed(20));
+    EXPECT_EQ(10, windows.watermark());
+
+    EXPECT_FALSE(windows.add(9, 1.F));
+    EXPECT_TRUE(windows.add(10, 1.F));
+
+    EXPECT_EQ(1U, windows.late());
+    EXPECT_EQ(1U, windows.bucket(0).count());
+    EXPECT_EQ(4U, windows.bucket(10).count());
+}
+
+TEST(WindowedStatistics, ReusesBucketsAsTimeAdvances)
+{
+    stats::WindowedStatistics windows(10, 4, 1000);
+
+    windows.add(5, 1.F);
+    windows.add(15, 2.F);
+    windows.add(75, 3.F); // buckets 0 to 30 leave the ring
+
+    EXPECT_EQ(0U, windows.bucket(5).count());
+    EXPECT_EQ(0U, windows.bucket(15).count());
+    EXPECT_EQ(1U, windows.bucket(75).count());
+    EXPECT_FALSE(windows.add(25, 4.F)); // no longer in the ring
+    EXPECT_TRUE(windows.add(45, 5.F));
+    EXPECT_EQ(1U, windows.late());
+    EXPECT_EQ(2U, windows.window(0, 80).count());
+}
+
+TEST(WindowedStatistics, WalksOnlyTheRetainedBuckets)
+{
+    const std::int64_t lowest  = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t highest = std::numeric_limits<std::int64_t>::max();
+
+    stats::WindowedStatistics windows(1, 4);
+    EXPECT_EQ(0U, windows.window(lowest, highest).count());
+
+    windows.add(lowest, 1.F);
+    windows.add(lowest + 1, 2.F);
+    EXPECT_EQ(2U, windows.window(lowest, highest).count());
+    EXPECT_EQ(1U, windows.window(lowest, lowest + 1).count());
+
+    windows.add(highest - 2, 3.F);
+    windows.add(highest - 1, 4.F); // the first two leave the ring
+    EXPECT_EQ(2U, windows.window(lowest, highest).count());
+    EXPECT_EQ(1U, windows.window(highest - 1, highest).count());
+    EXPECT_EQ(0U, windows.window(highest, lowest).count());
+
+    // wider buckets, with lateness, at both ends of the range
+    stats::WindowedStatistics late_windows(10, 4, 5);
+    EXPECT_TRUE(late_windows.add(lowest + 3, 1.F));
+    EXPECT_EQ(lowest, late_windows.watermark());
+    EXPECT_TRUE(late_windows.add(lowest, 2.F));
+    EXPECT_FALSE(late_windows.sealed(lowest + 10));
+    EXPECT_EQ(2U, late_windows.window(lowest, highest).count());
+
+    EXPECT_TRUE(late_windows.add(highest, 3.F));
+    EXPECT_EQ(highest - 5, late_windows.watermark());
+    EXPECT_TRUE(late_windows.add(highest - 3, 4.F)); // same bucket, within lateness
+    EXPECT_FALSE(late_windows.add(highest - 10, 5.F)); // the previous bucket is sealed
+    EXPECT_TRUE(late_windows.sealed(highest));
+    EXPECT_EQ(1U, late_windows.late());
+    EXPECT_EQ(2U, late_windows.bucket(highest).count());
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Repeatable pseudo-random values from a linear congruential generator, each
+// the offset plus a value in [0, 7) of varying spread.
+
+inline std::vector<float> noisy_values(std::size_t number_of_values, float offset)
+{
+    std::vector<float> values(number_of_values);
+    std::uint32_t state = 12345U;
+    for (float& value : values)
+    {
+        state = state * 1664525U + 1013904223U;
+        value = offset + static_cast<float>(state >> 8U) / static_cast<float>(1U << 24U) *
+                             static_cast<float>(state % 7);
+    }
+    return values;
+}